@@ -41,6 +41,10 @@ def _custom_config_impl(ctx):
     defs = []
     defs.append("V8_TYPED_ARRAY_MAX_SIZE_IN_HEAP=" +
         str(ctx.attr._v8_typed_array_max_size_in_heap[FlagInfo].value))
+    defs.append("V8_STUB_CACHE_PRIMARY_TABLE_BITS=" +
+        str(ctx.attr._v8_stub_cache_primary_table_bits[FlagInfo].value))
+    defs.append("V8_STUB_CACHE_SECONDARY_TABLE_BITS=" +
+        str(ctx.attr._v8_stub_cache_secondary_table_bits[FlagInfo].value))
     context = cc_common.create_compilation_context(defines = depset(defs))
     return [CcInfo(compilation_context = context)]
 
@@ -49,6 +53,10 @@ v8_custom_config = rule(
     attrs = {
         "_v8_typed_array_max_size_in_heap":
             attr.label(default = ":v8_typed_array_max_size_in_heap"),
+        "_v8_stub_cache_primary_table_bits":
+            attr.label(default = ":v8_stub_cache_primary_table_bits"),
+        "_v8_stub_cache_secondary_table_bits":
+            attr.label(default = ":v8_stub_cache_secondary_table_bits"),
     }
 )
 
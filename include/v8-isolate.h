@@ -153,6 +153,18 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * The target upper bound for main-thread garbage collection pauses in
+   * milliseconds, or zero if there is no target. V8 uses the budget to limit
+   * incremental marking steps, the young generation size, and the amount of
+   * compaction per garbage collection. Pauses that exceed the budget are
+   * reported through v8::metrics::Recorder.
+   */
+  double max_gc_pause_time_in_ms() const { return max_gc_pause_time_in_ms_; }
+  void set_max_gc_pause_time_in_ms(double budget_in_ms) {
+    max_gc_pause_time_in_ms_ = budget_in_ms;
+  }
+
  private:
   static constexpr size_t kMB = 1048576u;
   size_t code_range_size_ = 0;
@@ -160,6 +172,7 @@ class V8_EXPORT ResourceConstraints {
   size_t max_young_generation_size_ = 0;
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
+  double max_gc_pause_time_in_ms_ = 0;
   uint32_t* stack_limit_ = nullptr;
 };
 
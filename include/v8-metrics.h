@@ -80,6 +80,12 @@ struct GarbageCollectionYoungCycle {
   double main_thread_efficiency_in_bytes_per_us;
 };
 
+struct GarbageCollectionPauseBudgetExceeded {
+  bool is_young = false;
+  int64_t wall_clock_duration_in_us = -1;
+  int64_t budget_in_us = -1;
+};
+
 struct WasmModuleDecoded {
   bool async = false;
   bool streamed = false;
@@ -128,6 +134,7 @@ struct WasmModulesPerIsolate {
   V(GarbageCollectionFullMainThreadIncrementalSweep)        \
   V(GarbageCollectionFullMainThreadBatchedIncrementalSweep) \
   V(GarbageCollectionYoungCycle)                            \
+  V(GarbageCollectionPauseBudgetExceeded)                   \
   V(WasmModuleDecoded)                                      \
   V(WasmModuleCompiled)                                     \
   V(WasmModuleInstantiated)                                 \
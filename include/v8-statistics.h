@@ -133,6 +133,13 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the amount of committed heap memory in bytes for which huge pages
+   * were requested from the OS. This is non-zero only if huge pages are
+   * enabled via the --huge-pages flag.
+   */
+  size_t huge_page_backed_size() { return huge_page_backed_size_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -154,6 +161,7 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t huge_page_backed_size_;
 
   friend class V8;
   friend class Isolate;
@@ -6061,7 +6061,8 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      huge_page_backed_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -8693,6 +8694,8 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
 
   heap_statistics->total_heap_size_executable_ =
       heap->CommittedMemoryExecutable();
+  heap_statistics->huge_page_backed_size_ =
+      heap->CommittedHugePageBackedMemory();
   heap_statistics->heap_size_limit_ = heap->MaxReserved();
   // TODO(7424): There is no public API for the {WasmEngine} yet. Once such an
   // API becomes available we should report the malloced memory separately. For
@@ -205,6 +205,10 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+size_t OS::HugePageSize() { return 0; }
+
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   std::vector<SharedLibraryAddresses> result;
   // This function assumes that the layout of the file is as follows:
@@ -144,6 +144,10 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+size_t OS::HugePageSize() { return 0; }
+
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   UNREACHABLE();  // TODO(scottmg): Port, https://crbug.com/731217.
 }
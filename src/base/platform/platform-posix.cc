@@ -518,6 +518,28 @@ bool OS::HasLazyCommits() {
   return false;
 #endif
 }
+
+size_t OS::HugePageSize() {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE) && \
+    (V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64)
+  // Transparent huge pages are PMD-sized, i.e. 2 MB with 4 KB base pages.
+  return 2 * 1024 * 1024;
+#else
+  return 0;
+#endif
+}
+
+bool OS::AdviseHugePages(void* address, size_t size) {
+  const size_t huge_page_size = HugePageSize();
+  if (huge_page_size == 0) return false;
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % huge_page_size);
+  DCHECK_EQ(0, size % huge_page_size);
+#if defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
 #endif  // !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 
 const char* OS::GetGCFakeMMapFile() {
@@ -230,6 +230,10 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+size_t OS::HugePageSize() { return 0; }
+
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 void OS::Sleep(TimeDelta interval) { SbThreadSleep(interval.InMicroseconds()); }
 
 void OS::Abort() { SbSystemBreakIntoDebugger(); }
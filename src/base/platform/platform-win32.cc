@@ -955,6 +955,10 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+size_t OS::HugePageSize() { return 0; }
+
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 void OS::Sleep(TimeDelta interval) {
   ::Sleep(static_cast<DWORD>(interval.InMilliseconds()));
 }
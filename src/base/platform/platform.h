@@ -192,6 +192,15 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Returns the size of the huge pages that can be requested via
+  // AdviseHugePages(), or 0 if huge pages are not supported.
+  static size_t HugePageSize();
+
+  // Advises the OS to back the region [address, address + size) with huge
+  // pages. Both |address| and |size| must be aligned to HugePageSize(). This is
+  // advisory only; returns false if the advice was rejected.
+  static bool AdviseHugePages(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
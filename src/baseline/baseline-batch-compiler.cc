@@ -9,24 +9,289 @@
 #include "src/flags/flags.h"
 #if ENABLE_SPARKPLUG
 
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/mutex.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/handles/persistent-handles.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/parked-scope.h"
+#include "src/init/v8.h"
+#include "src/logging/counters.h"
+#include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
+#include "src/utils/locked-queue-inl.h"
 
 namespace v8 {
 namespace internal {
 namespace baseline {
 
+namespace {
+
+bool ShouldSkipFunction(Isolate* isolate, SharedFunctionInfo shared) {
+  // Skip functions where the bytecode has been flushed, that were compiled in
+  // the meantime or that can no longer be compiled (e.g. due to breakpoints).
+  return !shared.is_compiled() || shared.HasBaselineData() ||
+         !CanCompileWithBaseline(isolate, shared);
+}
+
+}  // namespace
+
+class BaselineCompilerTask {
+ public:
+  BaselineCompilerTask(Isolate* isolate, PersistentHandles* handles,
+                       SharedFunctionInfo shared)
+      : shared_function_info_(handles->NewHandle(shared)),
+        bytecode_(handles->NewHandle(shared.GetBytecodeArray(isolate))) {
+    DCHECK(shared.is_compiled());
+  }
+
+  // Executed on the background thread. Only generates the instructions; the
+  // Code object is allocated by Install on the main thread.
+  void Compile(LocalIsolate* local_isolate) {
+    base::ElapsedTimer timer;
+    timer.Start();
+    compiler_ = std::make_unique<BaselineCompiler>(
+        local_isolate, shared_function_info_, bytecode_);
+    compiler_->GenerateCode();
+    time_taken_ = timer.Elapsed();
+  }
+
+  // Executed on the main thread.
+  void Install(Isolate* isolate) {
+    Handle<SharedFunctionInfo> shared = shared_function_info_;
+    if (ShouldSkipFunction(isolate, *shared) ||
+        shared->GetBytecodeArray(isolate) != *bytecode_) {
+      return;
+    }
+    Handle<Code> code;
+    if (!compiler_->Build(isolate).ToHandle(&code)) return;
+    if (FLAG_print_code) code->Print();
+    Compiler::InstallBaselineCode(isolate, shared, code,
+                                  time_taken_.InMillisecondsF());
+  }
+
+  base::TimeDelta time_taken() const { return time_taken_; }
+
+ private:
+  Handle<SharedFunctionInfo> shared_function_info_;
+  Handle<BytecodeArray> bytecode_;
+  std::unique_ptr<BaselineCompiler> compiler_;
+  base::TimeDelta time_taken_;
+};
+
+class BaselineBatchCompilerJob {
+ public:
+  BaselineBatchCompilerJob(Isolate* isolate, Handle<WeakFixedArray> task_queue,
+                           int batch_size)
+      : handles_(isolate->NewPersistentHandles()) {
+    tasks_.reserve(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+      MaybeObject maybe_sfi = task_queue->Get(i);
+      task_queue->Set(i, HeapObjectReference::ClearedValue(isolate));
+      HeapObject heapobj;
+      // Skip functions where the weak reference is no longer valid.
+      if (!maybe_sfi.GetHeapObjectIfWeak(&heapobj)) continue;
+      SharedFunctionInfo shared = SharedFunctionInfo::cast(heapobj);
+      if (ShouldSkipFunction(isolate, shared)) continue;
+      tasks_.emplace_back(isolate, handles_.get(), shared);
+    }
+  }
+
+  // Executed on the background thread.
+  void Compile(LocalIsolate* local_isolate) {
+    DCHECK(local_isolate->heap()->IsParked());
+    local_isolate->heap()->AttachPersistentHandles(std::move(handles_));
+    {
+      UnparkedScope unparked_scope(local_isolate);
+      LocalHandleScope handle_scope(local_isolate);
+      for (BaselineCompilerTask& task : tasks_) {
+        task.Compile(local_isolate);
+        local_isolate->heap()->Safepoint();
+      }
+    }
+    // The handles of embedded objects have to outlive the compilation, since
+    // the Code objects are only built on the main thread.
+    handles_ = local_isolate->heap()->DetachPersistentHandles();
+  }
+
+  // Executed on the main thread.
+  void Install(Isolate* isolate) {
+    for (BaselineCompilerTask& task : tasks_) {
+      task.Install(isolate);
+    }
+  }
+
+  int function_count() const { return static_cast<int>(tasks_.size()); }
+
+  base::TimeDelta time_taken() const {
+    base::TimeDelta total;
+    for (const BaselineCompilerTask& task : tasks_) {
+      total += task.time_taken();
+    }
+    return total;
+  }
+
+ private:
+  std::vector<BaselineCompilerTask> tasks_;
+  std::unique_ptr<PersistentHandles> handles_;
+};
+
+class ConcurrentBaselineCompiler {
+ public:
+  explicit ConcurrentBaselineCompiler(Isolate* isolate);
+  ~ConcurrentBaselineCompiler();
+  ConcurrentBaselineCompiler(const ConcurrentBaselineCompiler&) = delete;
+  ConcurrentBaselineCompiler& operator=(const ConcurrentBaselineCompiler&) =
+      delete;
+
+  void CompileBatch(Handle<WeakFixedArray> task_queue, int batch_size);
+  void InstallBatch();
+
+  // Blocks until all batches handed to CompileBatch have been compiled. The
+  // batches still have to be installed by InstallBatch.
+  void AwaitCompileTasks();
+
+ private:
+  class JobDispatcher;
+
+  // Called on the background thread once a batch has been compiled.
+  void BatchCompiled(std::unique_ptr<BaselineBatchCompilerJob> job);
+
+  Isolate* isolate_;
+  std::unique_ptr<JobHandle> job_handle_;
+  LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> incoming_queue_;
+  LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> outgoing_queue_;
+
+  // Number of batches that were enqueued but not compiled yet.
+  int pending_batches_ = 0;
+  base::Mutex pending_batches_mutex_;
+  base::ConditionVariable pending_batches_cond_;
+};
+
+class ConcurrentBaselineCompiler::JobDispatcher final : public JobTask {
+ public:
+  JobDispatcher(Isolate* isolate, ConcurrentBaselineCompiler* compiler)
+      : isolate_(isolate),
+        worker_thread_runtime_call_stats_(
+            isolate->counters()->worker_thread_runtime_call_stats()),
+        compiler_(compiler) {}
+
+  void Run(JobDelegate* delegate) final {
+#ifdef V8_RUNTIME_CALL_STATS
+    WorkerThreadRuntimeCallStatsScope runtime_call_stats_scope(
+        worker_thread_runtime_call_stats_);
+    LocalIsolate local_isolate(isolate_, ThreadKind::kBackground,
+                               runtime_call_stats_scope.Get());
+#else   // V8_RUNTIME_CALL_STATS
+    LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+#endif  // V8_RUNTIME_CALL_STATS
+    std::unique_ptr<BaselineBatchCompilerJob> job;
+    while (!delegate->ShouldYield() &&
+           compiler_->incoming_queue_.Dequeue(&job)) {
+      DCHECK_NOT_NULL(job);
+      job->Compile(&local_isolate);
+      compiler_->BatchCompiled(std::move(job));
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return compiler_->incoming_queue_.IsEmpty() ? 0 : 1;
+  }
+
+ private:
+  Isolate* isolate_;
+  WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats_;
+  ConcurrentBaselineCompiler* compiler_;
+};
+
+ConcurrentBaselineCompiler::ConcurrentBaselineCompiler(Isolate* isolate)
+    : isolate_(isolate) {
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<JobDispatcher>(isolate_, this));
+}
+
+ConcurrentBaselineCompiler::~ConcurrentBaselineCompiler() {
+  if (job_handle_ && job_handle_->IsValid()) {
+    // Wait for the background job to finish, so that it does not access the
+    // queues after they are gone.
+    job_handle_->Cancel();
+  }
+  // Drop the batches that were not compiled or installed yet. This releases
+  // their persistent handles, which must not outlive the heap.
+  std::unique_ptr<BaselineBatchCompilerJob> job;
+  while (incoming_queue_.Dequeue(&job)) {
+  }
+  while (outgoing_queue_.Dequeue(&job)) {
+  }
+}
+
+void ConcurrentBaselineCompiler::CompileBatch(Handle<WeakFixedArray> task_queue,
+                                              int batch_size) {
+  DCHECK(job_handle_->IsValid());
+  {
+    base::MutexGuard guard(&pending_batches_mutex_);
+    pending_batches_++;
+  }
+  incoming_queue_.Enqueue(std::make_unique<BaselineBatchCompilerJob>(
+      isolate_, task_queue, batch_size));
+  job_handle_->NotifyConcurrencyIncrease();
+}
+
+void ConcurrentBaselineCompiler::BatchCompiled(
+    std::unique_ptr<BaselineBatchCompilerJob> job) {
+  outgoing_queue_.Enqueue(std::move(job));
+  isolate_->stack_guard()->RequestInstallBaselineCode();
+  base::MutexGuard guard(&pending_batches_mutex_);
+  if (--pending_batches_ == 0) pending_batches_cond_.NotifyAll();
+}
+
+void ConcurrentBaselineCompiler::AwaitCompileTasks() {
+  DCHECK(job_handle_->IsValid());
+  base::MutexGuard guard(&pending_batches_mutex_);
+  while (pending_batches_ > 0) {
+    pending_batches_cond_.Wait(&pending_batches_mutex_);
+  }
+}
+
+void ConcurrentBaselineCompiler::InstallBatch() {
+  CodePageCollectionMemoryModificationScope batch_allocation(isolate_->heap());
+  std::unique_ptr<BaselineBatchCompilerJob> job;
+  while (outgoing_queue_.Dequeue(&job)) {
+    HandleScope handle_scope(isolate_);
+    base::ElapsedTimer timer;
+    timer.Start();
+    job->Install(isolate_);
+    if (FLAG_trace_baseline_batch_compilation) {
+      CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
+      PrintF(trace_scope.file(),
+             "[Baseline batch compilation] Installed batch of %d functions "
+             "in %.2f ms on the main thread (generated in %.2f ms on a "
+             "background thread)\n",
+             job->function_count(), timer.Elapsed().InMillisecondsF(),
+             job->time_taken().InMillisecondsF());
+    }
+  }
+}
+
 BaselineBatchCompiler::BaselineBatchCompiler(Isolate* isolate)
     : isolate_(isolate),
       compilation_queue_(Handle<WeakFixedArray>::null()),
       last_index_(0),
       estimated_instruction_size_(0),
-      enabled_(true) {}
+      enabled_(true) {
+  if (FLAG_concurrent_sparkplug) {
+    concurrent_compiler_ =
+        std::make_unique<ConcurrentBaselineCompiler>(isolate_);
+  }
+}
 
 BaselineBatchCompiler::~BaselineBatchCompiler() {
   if (!compilation_queue_.is_null()) {
@@ -75,6 +340,10 @@ bool BaselineBatchCompiler::EnqueueFunction(Handle<JSFunction> function) {
              "functions\n",
              (last_index_ + 1));
     }
+    if (concurrent_compiler_) {
+      CompileBatchConcurrent(shared);
+      return false;
+    }
     CompileBatch(function);
     return true;
   }
@@ -115,6 +384,23 @@ void BaselineBatchCompiler::CompileBatch(Handle<JSFunction> function) {
   ClearBatch();
 }
 
+void BaselineBatchCompiler::CompileBatchConcurrent(
+    Handle<SharedFunctionInfo> shared) {
+  EnsureQueueCapacity();
+  compilation_queue_->Set(last_index_++, HeapObjectReference::Weak(*shared));
+  concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
+  ClearBatch();
+}
+
+void BaselineBatchCompiler::InstallBatch() {
+  DCHECK_NOT_NULL(concurrent_compiler_);
+  concurrent_compiler_->InstallBatch();
+}
+
+void BaselineBatchCompiler::AwaitCompileTasks() {
+  if (concurrent_compiler_) concurrent_compiler_->AwaitCompileTasks();
+}
+
 bool BaselineBatchCompiler::ShouldCompileBatch() const {
   return estimated_instruction_size_ >=
          FLAG_baseline_batch_compilation_threshold;
@@ -149,6 +435,8 @@ namespace v8 {
 namespace internal {
 namespace baseline {
 
+class ConcurrentBaselineCompiler {};
+
 BaselineBatchCompiler::BaselineBatchCompiler(Isolate* isolate)
     : isolate_(isolate),
       compilation_queue_(Handle<WeakFixedArray>::null()),
@@ -163,6 +451,10 @@ BaselineBatchCompiler::~BaselineBatchCompiler() {
   }
 }
 
+void BaselineBatchCompiler::InstallBatch() { UNREACHABLE(); }
+
+void BaselineBatchCompiler::AwaitCompileTasks() {}
+
 }  // namespace baseline
 }  // namespace internal
 }  // namespace v8
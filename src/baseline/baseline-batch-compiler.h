@@ -5,6 +5,8 @@
 #ifndef V8_BASELINE_BASELINE_BATCH_COMPILER_H_
 #define V8_BASELINE_BASELINE_BATCH_COMPILER_H_
 
+#include <memory>
+
 #include "src/handles/global-handles.h"
 #include "src/handles/handles.h"
 
@@ -12,6 +14,8 @@ namespace v8 {
 namespace internal {
 namespace baseline {
 
+class ConcurrentBaselineCompiler;
+
 class BaselineBatchCompiler {
  public:
   static const int kInitialQueueSize = 32;
@@ -26,6 +30,14 @@ class BaselineBatchCompiler {
   void set_enabled(bool enabled) { enabled_ = enabled; }
   bool is_enabled() { return enabled_; }
 
+  // Installs the code of batches that were compiled on a background thread.
+  // Called on the main thread from the INSTALL_BASELINE_CODE interrupt.
+  void InstallBatch();
+
+  // Blocks until the batches handed to the background thread are compiled.
+  // Only used for testing.
+  void AwaitCompileTasks();
+
  private:
   // Ensure there is enough space in the compilation queue to enqueue another
   // function, growing the queue if necessary.
@@ -38,6 +50,9 @@ class BaselineBatchCompiler {
   // Compiles the current batch and returns the number of functions compiled.
   void CompileBatch(Handle<JSFunction> function);
 
+  // Hands the current batch and |shared| to the background compiler.
+  void CompileBatchConcurrent(Handle<SharedFunctionInfo> shared);
+
   // Resets the current batch.
   void ClearBatch();
 
@@ -60,6 +75,9 @@ class BaselineBatchCompiler {
   // Flag indicating whether batch compilation is enabled.
   // Batch compilation can be dynamically disabled e.g. when creating snapshots.
   bool enabled_;
+
+  // Compiles batches on a background thread if --concurrent-sparkplug is set.
+  std::unique_ptr<ConcurrentBaselineCompiler> concurrent_compiler_;
 };
 
 }  // namespace baseline
@@ -24,6 +24,7 @@
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/common/globals.h"
 #include "src/execution/frame-constants.h"
+#include "src/execution/local-isolate.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-flags.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -269,17 +270,26 @@ std::unique_ptr<AssemblerBuffer> AllocateBuffer(
 }  // namespace
 
 BaselineCompiler::BaselineCompiler(
-    Isolate* isolate, Handle<SharedFunctionInfo> shared_function_info,
+    LocalIsolate* local_isolate,
+    Handle<SharedFunctionInfo> shared_function_info,
     Handle<BytecodeArray> bytecode, CodeLocation code_location)
-    : local_isolate_(isolate->AsLocalIsolate()),
-      stats_(isolate->counters()->runtime_call_stats()),
+    : local_isolate_(local_isolate),
+      stats_(local_isolate->is_main_thread()
+                 ? local_isolate->GetMainThreadIsolateUnsafe()
+                       ->counters()
+                       ->runtime_call_stats()
+                 : local_isolate->runtime_call_stats()),
       shared_function_info_(shared_function_info),
       bytecode_(bytecode),
-      masm_(isolate, CodeObjectRequired::kNo,
-            AllocateBuffer(isolate, bytecode, code_location)),
+      masm_(local_isolate->GetMainThreadIsolateUnsafe(),
+            CodeObjectRequired::kNo,
+            AllocateBuffer(local_isolate->GetMainThreadIsolateUnsafe(),
+                           bytecode, code_location)),
       basm_(&masm_),
-      iterator_(bytecode_),
-      zone_(isolate->allocator(), ZONE_NAME),
+      iterator_(
+          std::make_unique<interpreter::BytecodeArrayIterator>(bytecode_)),
+      zone_(local_isolate->GetMainThreadIsolateUnsafe()->allocator(),
+            ZONE_NAME),
       labels_(zone_.NewArray<BaselineLabels*>(bytecode_->length())) {
   MemsetPointer(labels_, nullptr, bytecode_->length());
 
@@ -296,10 +306,10 @@ BaselineCompiler::BaselineCompiler(
 void BaselineCompiler::GenerateCode() {
   {
     RCS_SCOPE(stats_, RuntimeCallCounterId::kCompileBaselinePreVisit);
-    for (; !iterator_.done(); iterator_.Advance()) {
+    for (; !iterator_->done(); iterator_->Advance()) {
       PreVisitSingleBytecode();
     }
-    iterator_.Reset();
+    iterator_->Reset();
   }
 
   // No code generated yet.
@@ -310,11 +320,12 @@ void BaselineCompiler::GenerateCode() {
     RCS_SCOPE(stats_, RuntimeCallCounterId::kCompileBaselineVisit);
     Prologue();
     AddPosition();
-    for (; !iterator_.done(); iterator_.Advance()) {
+    for (; !iterator_->done(); iterator_->Advance()) {
       VisitSingleBytecode();
       AddPosition();
     }
   }
+  iterator_.reset();
 }
 
 MaybeHandle<Code> BaselineCompiler::Build(Isolate* isolate) {
@@ -352,10 +363,15 @@ void BaselineCompiler::StoreRegisterPair(int operand_index, Register val0,
   __ StoreRegister(reg0, val0);
   __ StoreRegister(reg1, val1);
 }
+template <typename T>
+Handle<T> BaselineCompiler::Persist(Handle<T> handle) {
+  if (local_isolate_->is_main_thread()) return handle;
+  return local_isolate_->heap()->NewPersistentHandle(handle);
+}
 template <typename Type>
 Handle<Type> BaselineCompiler::Constant(int operand_index) {
-  return Handle<Type>::cast(
-      iterator().GetConstantForIndexOperand(operand_index, local_isolate_));
+  return Persist(Handle<Type>::cast(
+      iterator().GetConstantForIndexOperand(operand_index, local_isolate_)));
 }
 Smi BaselineCompiler::ConstantSmi(int operand_index) {
   return iterator().GetConstantAtIndexAsSmi(operand_index);
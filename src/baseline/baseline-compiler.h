@@ -53,11 +53,16 @@ class BaselineCompiler {
  public:
   enum CodeLocation { kOffHeap, kOnHeap };
   explicit BaselineCompiler(
-      Isolate* isolate, Handle<SharedFunctionInfo> shared_function_info,
+      LocalIsolate* local_isolate,
+      Handle<SharedFunctionInfo> shared_function_info,
       Handle<BytecodeArray> bytecode,
       CodeLocation code_location = CodeLocation::kOffHeap);
 
+  // Generates code into the assembler buffer. Off the main thread, this only
+  // needs an unparked LocalHeap with the handles of the function attached.
   void GenerateCode();
+  // Allocates the Code object. Always runs on the main thread, possibly after
+  // GenerateCode() finished on a background thread.
   MaybeHandle<Code> Build(Isolate* isolate);
   static int EstimateInstructionSize(BytecodeArray bytecode);
 
@@ -81,6 +86,10 @@ class BaselineCompiler {
   // Constant pool operands.
   template <typename Type>
   Handle<Type> Constant(int operand_index);
+  // Objects embedded into the code must stay alive until Build(), so off the
+  // main thread their handles are made persistent.
+  template <typename T>
+  Handle<T> Persist(Handle<T> handle);
   Smi ConstantSmi(int operand_index);
   template <typename Type>
   void LoadConstant(Register output, int operand_index);
@@ -157,7 +166,7 @@ class BaselineCompiler {
   INTRINSICS_LIST(DECLARE_VISITOR)
 #undef DECLARE_VISITOR
 
-  const interpreter::BytecodeArrayIterator& iterator() { return iterator_; }
+  const interpreter::BytecodeArrayIterator& iterator() { return *iterator_; }
 
   LocalIsolate* local_isolate_;
   RuntimeCallStats* stats_;
@@ -165,7 +174,9 @@ class BaselineCompiler {
   Handle<BytecodeArray> bytecode_;
   MacroAssembler masm_;
   BaselineAssembler basm_;
-  interpreter::BytecodeArrayIterator iterator_;
+  // Reset at the end of GenerateCode(), since the iterator is tied to the
+  // LocalHeap of the thread that created it.
+  std::unique_ptr<interpreter::BytecodeArrayIterator> iterator_;
   BytecodeOffsetTableBuilder bytecode_offset_table_builder_;
   Zone zone_;
 
@@ -54,7 +54,8 @@ MaybeHandle<Code> GenerateOnHeapCode(Isolate* isolate,
                                      Handle<SharedFunctionInfo> shared,
                                      Handle<BytecodeArray> bytecode) {
   CodePageCollectionMemoryModificationScope code_allocation(isolate->heap());
-  baseline::BaselineCompiler compiler(isolate, shared, bytecode,
+  baseline::BaselineCompiler compiler(isolate->AsLocalIsolate(), shared,
+                                      bytecode,
                                       baseline::BaselineCompiler::kOnHeap);
   compiler.GenerateCode();
   return compiler.Build(isolate);
@@ -63,7 +64,8 @@ MaybeHandle<Code> GenerateOnHeapCode(Isolate* isolate,
 MaybeHandle<Code> GenerateOffHeapCode(Isolate* isolate,
                                       Handle<SharedFunctionInfo> shared,
                                       Handle<BytecodeArray> bytecode) {
-  baseline::BaselineCompiler compiler(isolate, shared, bytecode);
+  baseline::BaselineCompiler compiler(isolate->AsLocalIsolate(), shared,
+                                      bytecode);
   compiler.GenerateCode();
   return compiler.Build(isolate);
 }
@@ -33,9 +33,10 @@ void BaselineCompiler::PrologueFillFrame() {
   interpreter::Register new_target_or_generator_register =
       bytecode_->incoming_new_target_or_generator_register();
   if (FLAG_debug_code) {
-    __ masm()->Cmp(kInterpreterAccumulatorRegister,
-                   handle(ReadOnlyRoots(local_isolate_).undefined_value(),
-                          local_isolate_));
+    __ masm()->Cmp(
+        kInterpreterAccumulatorRegister,
+        Persist(handle(ReadOnlyRoots(local_isolate_).undefined_value(),
+                       local_isolate_)));
     __ masm()->Assert(equal, AbortReason::kUnexpectedValue);
   }
   int register_count = bytecode_->register_count();
@@ -105,7 +105,8 @@ namespace internal {
   V(kNotEnoughVirtualRegistersRegalloc,                                     \
     "Not enough virtual registers (regalloc)")                              \
   V(kOptimizationDisabled, "Optimization disabled")                         \
-  V(kNeverOptimize, "Optimization is always disabled")
+  V(kNeverOptimize, "Optimization is always disabled")                      \
+  V(kZoneMemoryLimitExceeded, "Compiler zone memory limit exceeded")
 
 #define ERROR_MESSAGES_CONSTANTS(C, T) C,
 enum class BailoutReason : uint8_t {
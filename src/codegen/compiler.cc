@@ -918,6 +918,12 @@ void InsertCodeIntoOptimizedCodeCache(
   const CodeKind kind = compilation_info->code_kind();
   if (!CodeKindIsStoredInOptimizedCodeCache(kind)) return;
 
+  // Remember that this function reached the top tier. The hint travels with
+  // the SharedFunctionInfo into code caches produced after warm-up.
+  if (kind == CodeKindForTopTier()) {
+    compilation_info->shared_info()->set_was_optimized(true);
+  }
+
   if (compilation_info->function_context_specializing()) {
     // Function context specialization folds-in the function context, so no
     // sharing can occur. Make sure the optimized code cache is cleared.
@@ -994,7 +1000,10 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
                            Isolate* isolate,
                            OptimizedCompilationInfo* compilation_info,
                            CodeKind code_kind, Handle<JSFunction> function) {
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  OptimizingCompileDispatcher* dispatcher =
+      isolate->optimizing_compile_dispatcher();
+  if (!dispatcher->IsQueueAvailable() &&
+      !dispatcher->TryMakeRoomFor(*function)) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -1022,7 +1031,7 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
   }
 
   // The background recompile will own this job.
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job.get());
+  dispatcher->QueueForOptimization(job.get());
   job.release();
 
   if (FLAG_trace_concurrent_recompilation) {
@@ -1999,19 +2008,26 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
       // report these somehow, or silently ignore them?
       return false;
     }
+  }
+  InstallBaselineCode(isolate, shared, code, time_taken.InMillisecondsF());
+  return true;
+}
 
-    Handle<HeapObject> function_data =
-        handle(HeapObject::cast(shared->function_data(kAcquireLoad)), isolate);
-    Handle<BaselineData> baseline_data =
-        isolate->factory()->NewBaselineData(code, function_data);
-    shared->set_baseline_data(*baseline_data);
-    if (V8_LIKELY(FLAG_use_osr)) {
-      // Arm back edges for OSR
-      shared->GetBytecodeArray(isolate).set_osr_loop_nesting_level(
-          AbstractCode::kMaxLoopNestingMarker);
-    }
+// static
+void Compiler::InstallBaselineCode(Isolate* isolate,
+                                   Handle<SharedFunctionInfo> shared,
+                                   Handle<Code> code, double time_taken_ms) {
+  DCHECK_EQ(code->kind(), CodeKind::BASELINE);
+  Handle<HeapObject> function_data =
+      handle(HeapObject::cast(shared->function_data(kAcquireLoad)), isolate);
+  Handle<BaselineData> baseline_data =
+      isolate->factory()->NewBaselineData(code, function_data);
+  shared->set_baseline_data(*baseline_data);
+  if (V8_LIKELY(FLAG_use_osr)) {
+    // Arm back edges for OSR
+    shared->GetBytecodeArray(isolate).set_osr_loop_nesting_level(
+        AbstractCode::kMaxLoopNestingMarker);
   }
-  double time_taken_ms = time_taken.InMillisecondsF();
 
   CompilerTracer::TraceFinishBaselineCompile(isolate, shared, time_taken_ms);
 
@@ -2021,7 +2037,6 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
         handle(Script::cast(shared->script()), isolate),
         Handle<AbstractCode>::cast(code), CodeKind::BASELINE, time_taken_ms);
   }
-  return true;
 }
 
 // static
@@ -80,6 +80,11 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static bool CompileBaseline(Isolate* isolate, Handle<JSFunction> function,
                               ClearExceptionFlag flag,
                               IsCompiledScope* is_compiled_scope);
+  // Installs baseline {code} generated for {shared}, e.g. by a concurrent
+  // batch compilation job, and logs it.
+  static void InstallBaselineCode(Isolate* isolate,
+                                  Handle<SharedFunctionInfo> shared,
+                                  Handle<Code> code, double time_taken_ms);
   static bool CompileOptimized(Isolate* isolate, Handle<JSFunction> function,
                                ConcurrencyMode mode, CodeKind code_kind);
   static MaybeHandle<SharedFunctionInfo> CompileToplevel(
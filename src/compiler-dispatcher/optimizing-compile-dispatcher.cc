@@ -36,6 +36,11 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
   delete job;
 }
 
+int PriorityOf(JSFunction function) {
+  if (!function.has_feedback_vector()) return 0;
+  return function.feedback_vector().invocation_count();
+}
+
 }  // namespace
 
 class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
@@ -101,19 +106,43 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   DCHECK_EQ(0, ref_count_);
   DCHECK_EQ(0, input_queue_length_);
   DeleteArray(input_queue_);
+  DeleteArray(input_queue_priorities_);
 }
 
-OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
-    LocalIsolate* local_isolate) {
-  base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+OptimizedCompilationJob* OptimizingCompileDispatcher::RemoveInput(int i) {
+  DCHECK_LT(i, input_queue_length_);
+  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(i)];
   DCHECK_NOT_NULL(job);
+  // Close the gap by moving the older jobs one slot up, so that the remaining
+  // jobs keep their relative order.
+  for (int j = i; j > 0; j--) {
+    input_queue_[InputQueueIndex(j)] = input_queue_[InputQueueIndex(j - 1)];
+    input_queue_priorities_[InputQueueIndex(j)] =
+        input_queue_priorities_[InputQueueIndex(j - 1)];
+  }
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
   return job;
 }
 
+OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
+    LocalIsolate* local_isolate) {
+  base::MutexGuard access_input_queue_(&input_queue_mutex_);
+  if (input_queue_length_ == 0) return nullptr;
+  // Pick the hottest queued function. Ties go to the oldest job, which makes
+  // this plain FIFO order when prioritization is disabled.
+  int next = 0;
+  if (prioritize_) {
+    for (int i = 1; i < input_queue_length_; i++) {
+      if (input_queue_priorities_[InputQueueIndex(i)] >
+          input_queue_priorities_[InputQueueIndex(next)]) {
+        next = i;
+      }
+    }
+  }
+  return RemoveInput(next);
+}
+
 void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
                                               LocalIsolate* local_isolate) {
   if (!job) return;
@@ -151,11 +180,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   while (input_queue_length_ > 0) {
-    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-    DCHECK_NOT_NULL(job);
-    input_queue_shift_ = InputQueueIndex(1);
-    input_queue_length_--;
-    DisposeCompilationJob(job, true);
+    DisposeCompilationJob(RemoveInput(0), true);
   }
 }
 
@@ -241,11 +266,62 @@ void OptimizingCompileDispatcher::QueueForOptimization(
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
     input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_priorities_[InputQueueIndex(input_queue_length_)] =
+        PriorityOf(*job->compilation_info()->closure());
     input_queue_length_++;
   }
   V8::GetCurrentPlatform()->CallOnWorkerThread(
       std::make_unique<CompileTask>(isolate_, this));
 }
 
+bool OptimizingCompileDispatcher::TryMakeRoomFor(JSFunction function) {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  if (!prioritize_) return false;
+  HandleScope handle_scope(isolate_);
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  if (input_queue_length_ < input_queue_capacity_) return true;
+
+  // Jobs for functions that received code of the same kind in the meantime
+  // (e.g. through OSR or a synchronous compile) would be thrown away on
+  // install anyway.
+  for (int i = 0; i < input_queue_length_; i++) {
+    OptimizedCompilationInfo* info =
+        input_queue_[InputQueueIndex(i)]->compilation_info();
+    if (info->closure()->HasAvailableCodeKind(info->code_kind())) {
+      if (FLAG_trace_concurrent_recompilation) {
+        PrintF("  ** Dropping stale queued compilation for ");
+        info->closure()->ShortPrint();
+        PrintF(".\n");
+      }
+      DisposeCompilationJob(RemoveInput(i), false);
+      return true;
+    }
+  }
+
+  // Otherwise cancel the job for the coldest function, if it is colder than
+  // {function}. Its function will be marked again once it is hot enough.
+  int coldest = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    if (input_queue_priorities_[InputQueueIndex(i)] <
+        input_queue_priorities_[InputQueueIndex(coldest)]) {
+      coldest = i;
+    }
+  }
+  if (input_queue_priorities_[InputQueueIndex(coldest)] >=
+      PriorityOf(function)) {
+    return false;
+  }
+  OptimizedCompilationJob* job = RemoveInput(coldest);
+  if (FLAG_trace_concurrent_recompilation) {
+    PrintF("  ** Cancelling queued compilation for ");
+    job->compilation_info()->closure()->ShortPrint();
+    PrintF(" in favor of ");
+    function.ShortPrint();
+    PrintF(".\n");
+  }
+  DisposeCompilationJob(job, true);
+  return true;
+}
+
 }  // namespace internal
 }  // namespace v8
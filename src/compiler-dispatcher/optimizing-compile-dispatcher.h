@@ -18,6 +18,7 @@
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class OptimizedCompilationJob;
 class RuntimeCallStats;
@@ -31,8 +32,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_length_(0),
         input_queue_shift_(0),
         ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
+        recompilation_delay_(FLAG_concurrent_recompilation_delay),
+        prioritize_(FLAG_concurrent_recompilation_prioritize) {
     input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_priorities_ = NewArray<int>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -49,6 +52,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
     return input_queue_length_ < input_queue_capacity_;
   }
 
+  // Frees a slot in the full input queue for |function|, either by dropping
+  // a job whose function meanwhile got code of the requested kind or by
+  // cancelling a job for a colder function. Returns true if a slot was freed.
+  // This method must be called on the main thread.
+  bool TryMakeRoomFor(JSFunction function);
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
   // This method must be called on the main thread.
@@ -74,6 +83,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job, LocalIsolate* local_isolate);
   OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate);
+  // Removes the i-th oldest job from the input queue. The input queue mutex
+  // must be held.
+  OptimizedCompilationJob* RemoveInput(int i);
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -84,8 +96,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
+  // Circular queue of incoming recompilation tasks (including OSR). Jobs are
+  // handed out hottest first; see {input_queue_priorities_}.
   OptimizedCompilationJob** input_queue_;
+  // Invocation counts of the queued functions at the time they were queued,
+  // indexed like {input_queue_}.
+  int* input_queue_priorities_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
@@ -108,6 +124,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // is not safe to access them directly.
   int recompilation_delay_;
 
+  // Copy of FLAG_concurrent_recompilation_prioritize, for the same reason.
+  bool prioritize_;
+
   bool finalize_ = true;
 };
 }  // namespace internal
@@ -438,11 +438,42 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Load-to-use latencies of an L1 cache hit on recent Intel and AMD cores.
+constexpr int kIntegerLoadLatency = 4;
+constexpr int kFloatLoadLatency = 5;
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
+    case kX64Add:
+    case kX64Add32:
+    case kX64And:
+    case kX64And32:
+    case kX64Cmp:
+    case kX64Cmp32:
+    case kX64Cmp16:
+    case kX64Cmp8:
+    case kX64Test:
+    case kX64Test32:
+    case kX64Test16:
+    case kX64Test8:
+    case kX64Or:
+    case kX64Or32:
+    case kX64Xor:
+    case kX64Xor32:
+    case kX64Sub:
+    case kX64Sub32:
+      // A memory operand has to be loaded before the operation can start.
+      return (instr->addressing_mode() == kMode_None)
+                 ? 1
+                 : kIntegerLoadLatency + 1;
     case kSSEFloat64Mul:
+    case kAVXFloat64Mul:
       return 5;
     case kX64Imul:
     case kX64Imul32:
@@ -460,6 +491,12 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Sub:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
       return 3;
     case kSSEFloat32Mul:
     case kSSEFloat32ToFloat64:
@@ -470,7 +507,18 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
+    case kAVXFloat32Mul:
+    case kX64F32x4Add:
+    case kX64F32x4Sub:
+    case kX64F32x4Mul:
+    case kX64F64x2Add:
+    case kX64F64x2Sub:
+    case kX64F64x2Mul:
       return 4;
+    case kX64I16x8Mul:
+      return 5;
+    case kX64I32x4Mul:
+      return 10;
     case kX64Idiv:
       return 49;
     case kX64Idiv32:
@@ -483,7 +531,14 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
+    case kX64F32x4Div:
+    case kX64F32x4Sqrt:
       return 13;
+    case kX64F64x2Div:
+    case kX64F64x2Sqrt:
+      return 16;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
@@ -493,6 +548,32 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
       return 50;
     case kArchTruncateDoubleToI:
       return 6;
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+    case kX64Movl:
+    case kX64Movq:
+      // Stores and register-to-register forms have no addressing mode.
+      return (instr->HasOutput() && instr->addressing_mode() != kMode_None)
+                 ? kIntegerLoadLatency
+                 : 1;
+    case kX64MovqDecompressTaggedSigned:
+    case kX64MovqDecompressTaggedPointer:
+    case kX64MovqDecompressAnyTagged:
+      // The load is followed by adding the cage base.
+      return instr->HasOutput() ? kIntegerLoadLatency + 1 : 1;
+    case kX64Peek:
+      return kIntegerLoadLatency;
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+      return instr->HasOutput() ? kFloatLoadLatency : 1;
     default:
       return 1;
   }
@@ -4,11 +4,13 @@
 
 #include "src/compiler/loop-variable-optimizer.h"
 
+#include "src/compiler/all-nodes.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/node-marker.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
 #include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
@@ -345,6 +347,46 @@ void LoopVariableOptimizer::ChangeToPhisAndInsertGuards() {
   }
 }
 
+void LoopVariableOptimizer::MarkRedundantBoundsChecks(
+    SimplifiedOperatorBuilder* simplified) {
+  AllNodes all(zone(), graph());
+  for (Node* node : all.reachable) {
+    if (node->opcode() != IrOpcode::kCheckBounds) continue;
+    CheckBoundsParameters const& p = CheckBoundsParametersOf(node->op());
+    if (p.flags() & CheckBoundsFlag::kAbortOnOutOfBounds) continue;
+
+    // The index has to be a non-negative induction variable...
+    Node* index = node->InputAt(0);
+    Node* length = node->InputAt(1);
+    if (!FindInductionVariable(index)) continue;
+    Type const index_type = NodeProperties::GetType(index);
+    if (index_type.IsNone() || !index_type.Is(Type::PlainNumber()) ||
+        index_type.Min() < 0.0) {
+      continue;
+    }
+
+    // ...that is known to be below {length} wherever the check executes.
+    Node* control = NodeProperties::GetControlInput(node);
+    if (!reduced_.Get(control)) continue;
+    bool in_bounds = false;
+    for (Constraint constraint : limits_.Get(control)) {
+      if (constraint.left == index && constraint.right == length &&
+          constraint.kind == InductionVariable::kStrict) {
+        in_bounds = true;
+        break;
+      }
+    }
+    if (!in_bounds) continue;
+
+    TRACE("Bounds check %i is redundant (index %i, length %i)\n", node->id(),
+          index->id(), length->id());
+    NodeProperties::ChangeOp(
+        node, simplified->CheckBounds(
+                  p.check_parameters().feedback(),
+                  p.flags() | CheckBoundsFlag::kAbortOnOutOfBounds));
+  }
+}
+
 #undef TRACE
 
 }  // namespace compiler
@@ -16,6 +16,7 @@ namespace compiler {
 class CommonOperatorBuilder;
 class Graph;
 class Node;
+class SimplifiedOperatorBuilder;
 
 class InductionVariable : public ZoneObject {
  public:
@@ -81,6 +82,12 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Turns CheckBounds nodes into aborting checks if their index is a
+  // non-negative induction variable that a dominating branch has already
+  // compared against the same length. Needs the types computed by the Typer
+  // and must run after {Run}.
+  void MarkRedundantBoundsChecks(SimplifiedOperatorBuilder* simplified);
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
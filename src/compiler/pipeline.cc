@@ -312,6 +312,13 @@ class PipelineData {
   AccountingAllocator* allocator() const { return allocator_; }
   OptimizedCompilationInfo* info() const { return info_; }
   ZoneStats* zone_stats() const { return zone_stats_; }
+  // Whether the zones of this compilation hold more memory than
+  // --turbo-max-zone-memory allows.
+  bool ExceedsZoneMemoryLimit() const {
+    return FLAG_turbo_max_zone_memory > 0 &&
+           zone_stats_->GetCurrentAllocatedBytes() >
+               FLAG_turbo_max_zone_memory * MB;
+  }
   CompilationDependencies* dependencies() const { return dependencies_; }
   PipelineStatistics* pipeline_statistics() { return pipeline_statistics_; }
   OsrHelper* osr_helper() { return &(*osr_helper_); }
@@ -1118,7 +1125,14 @@ PipelineCompilationJob::PipelineCompilationJob(
       pipeline_(&data_),
       linkage_(nullptr) {}
 
-PipelineCompilationJob::~PipelineCompilationJob() = default;
+PipelineCompilationJob::~PipelineCompilationJob() {
+  if (FLAG_trace_turbo_zone_memory) {
+    PrintF("[zone memory for %s: peak %zu KB, total %zu KB]\n",
+           compilation_info()->GetDebugName().get(),
+           zone_stats_.GetMaxAllocatedBytes() / KB,
+           zone_stats_.GetTotalAllocatedBytes() / KB);
+  }
+}
 
 namespace {
 // Ensure that the RuntimeStats table is set on the PipelineData for
@@ -1868,6 +1882,20 @@ struct LoadEliminationPhase {
   }
 };
 
+struct BoundsCheckEliminationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(BoundsCheckElimination)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    // Load elimination has unified the length loads of loop conditions and
+    // element accesses by now, so the conditions can be matched with the
+    // bounds checks.
+    LoopVariableOptimizer induction_vars(data->jsgraph()->graph(),
+                                         data->common(), temp_zone);
+    induction_vars.Run();
+    induction_vars.MarkRedundantBoundsChecks(data->simplified());
+  }
+};
+
 struct MemoryOptimizationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(MemoryOptimization)
 
@@ -2708,6 +2736,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+
+  if (FLAG_turbo_loop_variable) {
+    Run<BoundsCheckEliminationPhase>();
+    RunPrintAndVerify(BoundsCheckEliminationPhase::phase_name());
+  }
   data->DeleteTyper();
 
   if (FLAG_turbo_escape) {
@@ -2721,6 +2754,12 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify(EscapeAnalysisPhase::phase_name());
   }
 
+  if (data->ExceedsZoneMemoryLimit()) {
+    info()->AbortOptimization(BailoutReason::kZoneMemoryLimitExceeded);
+    data->EndPhaseKind();
+    return false;
+  }
+
   if (FLAG_assert_types) {
     Run<TypeAssertionsPhase>();
     RunPrintAndVerify(TypeAssertionsPhase::phase_name());
@@ -2772,6 +2811,12 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify(StoreStoreEliminationPhase::phase_name(), true);
   }
 
+  if (data->ExceedsZoneMemoryLimit()) {
+    info()->AbortOptimization(BailoutReason::kZoneMemoryLimitExceeded);
+    data->EndPhaseKind();
+    return false;
+  }
+
   // Optimize control flow.
   if (FLAG_turbo_cf_optimization) {
     Run<ControlFlowOptimizationPhase>();
@@ -3491,6 +3536,14 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     return false;
   }
 
+  // The instruction sequence is live next to the graph here, and register
+  // allocation only grows it further.
+  if (data->info()->IsOptimizing() && data->ExceedsZoneMemoryLimit()) {
+    info()->AbortOptimization(BailoutReason::kZoneMemoryLimitExceeded);
+    data->EndPhaseKind();
+    return false;
+  }
+
   if (info()->trace_turbo_json() && !data->MayHaveUnverifiableGraph()) {
     UnparkedScopeIfNeeded scope(data->broker());
     AllowHandleDereference allow_deref;
@@ -3527,7 +3580,15 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     AllocateRegistersForTopTier(config.get(), call_descriptor, run_verifier);
   } else {
     const RegisterConfiguration* config = RegisterConfiguration::Default();
-    if (data->info()->IsTurboprop() && FLAG_turboprop_mid_tier_reg_alloc) {
+    // Linear scan allocation is superlinear in the number of live ranges, so
+    // huge JavaScript functions fall back to the linear-time mid-tier
+    // allocator to bound their compile time.
+    bool use_mid_tier_register_allocator =
+        (data->info()->IsTurboprop() && FLAG_turboprop_mid_tier_reg_alloc) ||
+        (data->info()->IsOptimizing() &&
+         static_cast<unsigned>(data->sequence()->VirtualRegisterCount()) >
+             FLAG_turbo_mid_tier_regalloc_threshold);
+    if (use_mid_tier_register_allocator) {
       AllocateRegistersForMidTier(config, call_descriptor, run_verifier);
     } else {
       AllocateRegistersForTopTier(config, call_descriptor, run_verifier);
@@ -649,12 +649,40 @@ void Scheduler::BuildCFG() {
   control_flow_builder_ = zone_->New<CFGBuilder>(zone_, this);
   control_flow_builder_->Run();
 
+  if (FLAG_turbo_defer_cold_blocks) MarkColdBlocksDeferred();
+
   // Initialize per-block data.
   // Reserve an extra 10% to avoid resizing vector when fusing floating control.
   scheduled_nodes_.reserve(schedule_->BasicBlockCount() * 1.1);
   scheduled_nodes_.resize(schedule_->BasicBlockCount());
 }
 
+void Scheduler::MarkColdBlocksDeferred() {
+  // Blocks that end in a deoptimization or a throw are only reached on slow
+  // paths, and so is every block that can only continue into one of them.
+  // Marking them deferred moves them out of line into the cold tail of the
+  // generated code, keeping the hot path contiguous. Predecessors of merges
+  // are in split-edge form, so a deferred block with multiple predecessors
+  // never ends up with a non-deferred one.
+  ZoneQueue<BasicBlock*> queue(zone_);
+  for (BasicBlock* block : *schedule_->all_blocks()) {
+    if (block->control() == BasicBlock::kDeoptimize ||
+        block->control() == BasicBlock::kThrow) {
+      queue.push(block);
+    }
+  }
+  while (!queue.empty()) {
+    BasicBlock* block = queue.front();
+    queue.pop();
+    if (block->deferred() || block == schedule_->start()) continue;
+    TRACE("Marking cold block id:%d as deferred\n", block->id().ToInt());
+    block->set_deferred(true);
+    for (BasicBlock* predecessor : block->predecessors()) {
+      if (predecessor->SuccessorCount() == 1) queue.push(predecessor);
+    }
+  }
+}
+
 
 // -----------------------------------------------------------------------------
 // Phase 2: Compute special RPO and dominator tree.
@@ -113,6 +113,7 @@ class V8_EXPORT_PRIVATE Scheduler {
   // Phase 1: Build control-flow graph.
   friend class CFGBuilder;
   void BuildCFG();
+  void MarkColdBlocksDeferred();
 
   // Phase 2: Compute special RPO and dominator tree.
   friend class SpecialRPONumberer;
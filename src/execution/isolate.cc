@@ -47,6 +47,7 @@
 #include "src/execution/local-isolate.h"
 #include "src/execution/messages.h"
 #include "src/execution/microtask-queue.h"
+#include "src/execution/optimization-profile.h"
 #include "src/execution/protectors-inl.h"
 #include "src/execution/runtime-profiler.h"
 #include "src/execution/simulator.h"
@@ -3110,11 +3111,20 @@ void Isolate::Deinit() {
     optimizing_compile_dispatcher_ = nullptr;
   }
 
+  // Cancels the concurrent baseline compilation job. Pending batches hold
+  // persistent handles, so this has to happen before the heap is torn down.
+  delete baseline_batch_compiler_;
+  baseline_batch_compiler_ = nullptr;
+
   // All client isolates should already be detached.
   DCHECK_NULL(client_isolate_head_);
 
   DumpAndResetStats();
 
+  if (FLAG_optimization_profile_output != nullptr) {
+    OptimizationProfile::Write(this, FLAG_optimization_profile_output);
+  }
+
   if (FLAG_print_deopt_stress) {
     PrintF(stdout, "=== Stress deopt counter: %u\n", stress_deopt_count_);
   }
@@ -3148,9 +3158,6 @@ void Isolate::Deinit() {
   delete compiler_dispatcher_;
   compiler_dispatcher_ = nullptr;
 
-  delete baseline_batch_compiler_;
-  baseline_batch_compiler_ = nullptr;
-
   // This stops cancelable tasks (i.e. concurrent marking tasks)
   cancelable_task_manager()->CancelAndWait();
 
@@ -3716,6 +3723,15 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     optimizing_compile_dispatcher_ = new OptimizingCompileDispatcher(this);
   }
 
+  if (FLAG_optimization_profile_input != nullptr) {
+    optimization_profile_ =
+        OptimizationProfile::Read(FLAG_optimization_profile_input);
+    if (!optimization_profile_) {
+      PrintF(stderr, "Cannot read optimization profile from %s\n",
+             FLAG_optimization_profile_input);
+    }
+  }
+
   // Initialize runtime profiler before deserialization, because collections may
   // occur, clearing/updating ICs.
   runtime_profiler_ = new RuntimeProfiler(this);
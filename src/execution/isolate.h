@@ -102,6 +102,7 @@ class Logger;
 class MaterializedObjectStore;
 class Microtask;
 class MicrotaskQueue;
+class OptimizationProfile;
 class OptimizingCompileDispatcher;
 class PersistentHandles;
 class PersistentHandlesList;
@@ -1408,6 +1409,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     DCHECK_NOT_NULL(optimizing_compile_dispatcher_);
     return optimizing_compile_dispatcher_;
   }
+  // Functions optimized in an earlier run, read from
+  // --optimization-profile-input. Null if no profile was given.
+  OptimizationProfile* optimization_profile() const {
+    return optimization_profile_.get();
+  }
+
   // Flushes all pending concurrent optimzation jobs from the optimizing
   // compile dispatcher's queue.
   void AbortConcurrentOptimization(BlockingBehavior blocking_behavior);
@@ -2131,6 +2138,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   OptimizingCompileDispatcher* optimizing_compile_dispatcher_ = nullptr;
 
+  std::unique_ptr<OptimizationProfile> optimization_profile_;
+
   std::unique_ptr<PersistentHandlesList> persistent_handles_list_;
 
   // Counts deopt points if deopt_every_n_times is enabled.
@@ -112,6 +112,10 @@ class V8_EXPORT_PRIVATE LocalIsolate final : private HiddenLocalFactory {
   }
   LocalIsolate* AsLocalIsolate() { return this; }
 
+  // Unlike AsIsolate, this is allowed off the main thread. Only use it for
+  // state that is safe to read concurrently, e.g. the allocator or options.
+  Isolate* GetMainThreadIsolateUnsafe() const { return isolate_; }
+
   Object* pending_message_address() {
     return isolate_->pending_message_address();
   }
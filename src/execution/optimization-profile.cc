@@ -0,0 +1,94 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/optimization-profile.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "src/base/functional.h"
+#include "src/execution/isolate.h"
+#include "src/heap/heap.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+std::string OptimizationProfile::ScriptKeyFor(Script script) {
+  Object name = script.name();
+  if (!name.IsString() || String::cast(name).length() == 0) return {};
+  Object source = script.source();
+  if (!source.IsString()) return {};
+  int length = 0;
+  std::unique_ptr<char[]> chars = String::cast(source).ToCString(
+      ALLOW_NULLS, ROBUST_STRING_TRAVERSAL, &length);
+  std::ostringstream stream;
+  stream << String::cast(name).ToCString().get() << ":" << length << ":"
+         << std::hex << base::hash_range(chars.get(), chars.get() + length);
+  return stream.str();
+}
+
+// static
+bool OptimizationProfile::KeyFor(SharedFunctionInfo shared,
+                                 ScriptKeyCache* script_keys,
+                                 std::string* key) {
+  Object maybe_script = shared.script();
+  if (!maybe_script.IsScript()) return false;
+  Script script = Script::cast(maybe_script);
+  auto it = script_keys->find(script.id());
+  if (it == script_keys->end()) {
+    it = script_keys->emplace(script.id(), ScriptKeyFor(script)).first;
+  }
+  if (it->second.empty()) return false;
+  std::ostringstream stream;
+  stream << it->second << ":" << shared.StartPosition();
+  *key = stream.str();
+  // The profile is line based.
+  return key->find('\n') == std::string::npos;
+}
+
+// static
+void OptimizationProfile::Write(Isolate* isolate, const char* path) {
+  std::ofstream file(path);
+  if (!file.good()) {
+    PrintF(stderr, "Cannot write optimization profile to %s\n", path);
+    return;
+  }
+  ScriptKeyCache script_keys;
+  HeapObjectIterator iterator(isolate->heap());
+  for (HeapObject obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (!obj.IsSharedFunctionInfo()) continue;
+    SharedFunctionInfo shared = SharedFunctionInfo::cast(obj);
+    std::string key;
+    if (shared.was_optimized() && KeyFor(shared, &script_keys, &key)) {
+      file << key << "\n";
+    }
+  }
+}
+
+// static
+std::unique_ptr<OptimizationProfile> OptimizationProfile::Read(
+    const char* path) {
+  std::ifstream file(path);
+  if (!file.good()) return nullptr;
+  std::unique_ptr<OptimizationProfile> profile =
+      std::make_unique<OptimizationProfile>();
+  for (std::string line; std::getline(file, line);) {
+    if (!line.empty()) profile->functions_.insert(line);
+  }
+  return profile;
+}
+
+bool OptimizationProfile::Contains(SharedFunctionInfo shared) const {
+  if (functions_.empty()) return false;
+  std::string key;
+  return KeyFor(shared, &script_keys_, &key) && functions_.count(key) != 0;
+}
+
+}  // namespace internal
+}  // namespace v8
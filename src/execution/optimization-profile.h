@@ -0,0 +1,68 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_OPTIMIZATION_PROFILE_H_
+#define V8_EXECUTION_OPTIMIZATION_PROFILE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Script;
+class SharedFunctionInfo;
+
+// The set of functions that reached the top tier in an earlier run, keyed by
+// script name, a hash of the script source and start position. Entries of
+// scripts that changed since the profile was written no longer match and are
+// ignored. Type feedback itself (maps, call targets)
+// only makes sense in the heap that collected it, but which functions got
+// hot enough to be optimized carries over to the next run of the same
+// scripts. Functions listed in the profile are marked as previously
+// optimized when their feedback vector is allocated, so the runtime profiler
+// tiers them up early (see --early-reoptimization).
+class OptimizationProfile {
+ public:
+  OptimizationProfile() = default;
+  OptimizationProfile(const OptimizationProfile&) = delete;
+  OptimizationProfile& operator=(const OptimizationProfile&) = delete;
+
+  // Writes all functions of |isolate| that reached the top tier to |path|,
+  // one per line.
+  static void Write(Isolate* isolate, const char* path);
+
+  // Reads a profile written by {Write}. Returns nullptr if |path| cannot be
+  // opened.
+  static std::unique_ptr<OptimizationProfile> Read(const char* path);
+
+  bool Contains(SharedFunctionInfo shared) const;
+
+ private:
+  // Maps script ids to the script part of the keys, so that the source of a
+  // script is hashed only once.
+  using ScriptKeyCache = std::unordered_map<int, std::string>;
+
+  // Returns the script name, source length and source hash, or an empty
+  // string for scripts that cannot be identified across runs, e.g. because
+  // they are unnamed.
+  static std::string ScriptKeyFor(Script script);
+
+  // Returns false for functions that cannot be identified across runs.
+  static bool KeyFor(SharedFunctionInfo shared, ScriptKeyCache* script_keys,
+                     std::string* key);
+
+  std::unordered_set<std::string> functions_;
+  mutable ScriptKeyCache script_keys_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_OPTIMIZATION_PROFILE_H_
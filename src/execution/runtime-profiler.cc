@@ -24,6 +24,16 @@ namespace internal {
 // optimized.
 static const int kProfilerTicksBeforeOptimization = 3;
 
+// Number of times a function has to be seen on the stack before it is
+// optimized by the mid-tier compiler. Mid-tier code is cheap to produce, so
+// warm functions are tiered up earlier than they would be to TurboFan.
+static const int kProfilerTicksBeforeMidTierOptimization = 1;
+
+// Number of times a function has to be seen on the stack before it is
+// reoptimized, if it already reached the top tier earlier (possibly in a
+// previous process that produced the code cache it was deserialized from).
+static const int kProfilerTicksBeforeReoptimization = 1;
+
 // The number of ticks required for optimizing a function increases with
 // the size of the bytecode. This is in addition to the
 // kProfilerTicksBeforeOptimization required for any function.
@@ -41,7 +51,8 @@ static const int kMaxBytecodeSizeForEarlyOpt = 81;
 #define OPTIMIZATION_REASON_LIST(V)   \
   V(DoNotOptimize, "do not optimize") \
   V(HotAndStable, "hot and stable")   \
-  V(SmallFunction, "small function")
+  V(SmallFunction, "small function")  \
+  V(PreviouslyOptimized, "previously optimized")
 
 enum class OptimizationReason : uint8_t {
 #define OPTIMIZATION_REASON_CONSTANTS(Constant, message) k##Constant,
@@ -193,6 +204,9 @@ bool ShouldOptimizeAsSmallFunction(int bytecode_size, int ticks,
                                    bool active_tier_is_turboprop) {
   if (any_ic_changed || bytecode_size >= kMaxBytecodeSizeForEarlyOpt)
     return false;
+  // Small functions are optimized early by the mid-tier already. Tiering up
+  // further to TurboFan is only worth it once they got hot.
+  if (active_tier_is_turboprop) return false;
   return true;
 }
 
@@ -208,8 +222,19 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
   }
   int ticks = function.feedback_vector().profiler_ticks();
   bool active_tier_is_turboprop = function.ActiveTierIsMidtierTurboprop();
+  // Without any optimized code, functions tier up to the mid-tier if there is
+  // one. Use the mid-tier's cheaper threshold in that case.
+  bool next_tier_is_midtier = V8_UNLIKELY(FLAG_turboprop) &&
+                              !FLAG_turboprop_as_toptier &&
+                              !active_tier_is_turboprop;
+  if (FLAG_early_reoptimization && !next_tier_is_midtier &&
+      function.shared().was_optimized() &&
+      ticks >= kProfilerTicksBeforeReoptimization) {
+    return OptimizationReason::kPreviouslyOptimized;
+  }
   int ticks_for_optimization =
-      kProfilerTicksBeforeOptimization +
+      (next_tier_is_midtier ? kProfilerTicksBeforeMidTierOptimization
+                            : kProfilerTicksBeforeOptimization) +
       (bytecode.length() / kBytecodeSizeAllowancePerTick);
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
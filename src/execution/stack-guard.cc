@@ -319,6 +319,12 @@ Object StackGuard::HandleInterrupts() {
     isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
   }
 
+  if (TestAndClear(&interrupt_flags, INSTALL_BASELINE_CODE)) {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.InstallBaselineCode");
+    isolate_->baseline_batch_compiler()->InstallBatch();
+  }
+
   if (TestAndClear(&interrupt_flags, API_INTERRUPT)) {
     TRACE_EVENT0("v8.execute", "V8.InvokeApiInterruptCallbacks");
     // Callbacks must be invoked outside of ExecutionAccess lock.
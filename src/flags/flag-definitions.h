@@ -585,6 +585,16 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 
 DEFINE_INT(interrupt_budget, 132 * KB,
            "interrupt budget which should be used for the profiler counter")
+DEFINE_BOOL(early_reoptimization, false,
+            "tier up functions whose shared function info records an earlier "
+            "optimization (e.g. from a code cache) after a single tick")
+DEFINE_STRING(optimization_profile_output, nullptr,
+              "on isolate teardown, write the functions that were optimized "
+              "to the given file")
+DEFINE_STRING(optimization_profile_input, nullptr,
+              "tier up the functions listed in the given file (written by "
+              "--optimization-profile-output) early")
+DEFINE_IMPLICATION(optimization_profile_input, early_reoptimization)
 
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
@@ -674,8 +684,11 @@ DEFINE_BOOL(sparkplug, ENABLE_SPARKPLUG_BY_DEFAULT,
             "enable Sparkplug baseline compiler")
 DEFINE_BOOL(always_sparkplug, false, "directly tier up to Sparkplug code")
 DEFINE_BOOL(sparkplug_on_heap, false, "compile Sparkplug code directly on heap")
+DEFINE_BOOL(concurrent_sparkplug, false,
+            "generate Sparkplug code of batches on a background thread")
 #if ENABLE_SPARKPLUG
 DEFINE_IMPLICATION(always_sparkplug, sparkplug)
+DEFINE_NEG_IMPLICATION(concurrent_sparkplug, sparkplug_on_heap)
 DEFINE_BOOL(baseline_batch_compilation, true, "batch compile Sparkplug code")
 #else
 DEFINE_BOOL(baseline_batch_compilation, false, "batch compile Sparkplug code")
@@ -711,6 +724,9 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_recompilation_prioritize, true,
+            "compile the hottest queued function first and let hot functions "
+            "displace colder ones from a full recompilation queue")
 DEFINE_BOOL(concurrent_inlining, true,
             "run optimizing compiler's inlining phase on a separate thread")
 DEFINE_BOOL(stress_concurrent_inlining, false,
@@ -764,6 +780,8 @@ DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
 DEFINE_BOOL(trace_turbo_loop, false, "trace TurboFan's loop optimizations")
 DEFINE_BOOL(trace_turbo_alloc, false, "trace TurboFan's register allocator")
+DEFINE_BOOL(trace_turbo_zone_memory, false,
+            "trace the peak and total zone memory of each TurboFan job")
 DEFINE_BOOL(trace_all_uses, false, "trace all use positions")
 DEFINE_BOOL(trace_representation, false, "trace representation types")
 DEFINE_BOOL(
@@ -793,6 +811,8 @@ DEFINE_BOOL(turbo_stats_nvp, false,
 DEFINE_BOOL(turbo_stats_wasm, false,
             "print TurboFan statistics of wasm compilations")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
+DEFINE_BOOL(turbo_defer_cold_blocks, true,
+            "move blocks leading only to deopts and throws out of line")
 DEFINE_BOOL(function_context_specialization, false,
             "enable function context specialization in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
@@ -844,6 +864,12 @@ DEFINE_BOOL(turbo_profiling_log_builtins, false,
             "that V8 was built with v8_enable_builtins_profiling=true)")
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
+DEFINE_UINT(turbo_mid_tier_regalloc_threshold, 16 * KB,
+            "use the mid-tier register allocator for optimized functions "
+            "with more virtual registers than this")
+DEFINE_SIZE_T(turbo_max_zone_memory, 0,
+              "abort optimization once the TurboFan zones of a single job hold "
+              "more than this many MB (0 means no limit)")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
@@ -1182,8 +1208,13 @@ DEFINE_BOOL(parallel_marking, V8_CONCURRENT_MARKING_BOOL,
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
+DEFINE_BOOL(incremental_ephemeron_marking, false,
+            "run ephemeron fixpoint iterations during incremental marking")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_code_space_sweeping, true,
+            "sweep code space concurrently if code memory is not write "
+            "protected")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
@@ -1242,7 +1273,26 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
+DEFINE_FLOAT(gc_pause_budget, 0,
+             "target upper bound for main-thread GC pauses in ms (0 = none)")
+DEFINE_BOOL(trace_gc_pause_budget, false,
+            "trace decisions and misses of the GC pause budget")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_pages, false,
+            "request huge pages for the code range and old space pages")
+DEFINE_SIZE_T(huge_page_region_size, 64,
+              "size of the huge-page backed region for old space pages (in "
+              "MBytes)")
+DEFINE_SIZE_T(page_pool_size, 0,
+              "maximum size of the process-wide pool of free pages that is "
+              "shared across heaps (in MBytes)")
+DEFINE_BOOL(page_pool_decommit, true,
+            "decommit pages eagerly when returning them to the process-wide "
+            "page pool")
+DEFINE_SIZE_T(large_page_cache_size, 0,
+              "maximum size of freed large object pages that are kept "
+              "committed for reuse by later large object allocations (in "
+              "MBytes)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
@@ -1487,6 +1537,9 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
 DEFINE_BOOL(lazy_compile_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
+            "also post lazy top-level functions to parallel compile tasks")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, parallel_compile_tasks)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
@@ -1777,6 +1830,8 @@ DEFINE_NEG_NEG_IMPLICATION(text_is_readable, partial_constant_pool)
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_BOOL(minor_mc_parallel_marking, true,
+            "drain the young generation marking worklist in parallel")
 #else
 DEFINE_BOOL_READONLY(minor_mc, false,
                      "perform young generation mark compact GCs")
@@ -2112,6 +2167,9 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
+#ifdef ENABLE_MINOR_MC
+DEFINE_NEG_IMPLICATION(single_threaded_gc, minor_mc_parallel_marking)
+#endif  // ENABLE_MINOR_MC
 
 #undef FLAG
 
@@ -90,10 +90,18 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     }
   }
 
+  // Code pages are MemoryChunk::kAlignment-aligned and thus never straddle a
+  // huge page boundary.
+  if (FLAG_huge_pages) {
+    huge_page_region_ = AdviseHugePages(
+        base::AddressRegion(base(), reservation()->region().end() - base()));
+  }
+
   return true;
 }
 
 void CodeRange::Free() {
+  huge_page_region_ = base::AddressRegion();
   if (IsReserved()) {
     GetCodeRangeAddressHint()->NotifyFreedCodeRange(
         reservation()->region().begin(), reservation()->region().size());
@@ -105,6 +105,12 @@ class CodeRange final : public VirtualMemoryCage {
 
   bool InitReservation(v8::PageAllocator* page_allocator, size_t requested);
 
+  // The part of the code range that is backed by huge pages, see
+  // FLAG_huge_pages. Empty if huge pages are not used.
+  const base::AddressRegion& huge_page_region() const {
+    return huge_page_region_;
+  }
+
   void Free();
 
   // Remap and copy the embedded builtins into this CodeRange. This method is
@@ -136,6 +142,8 @@ class CodeRange final : public VirtualMemoryCage {
   // race during Isolate::Init.
   base::Mutex remap_embedded_builtins_mutex_;
 
+  base::AddressRegion huge_page_region_;
+
 #ifdef V8_OS_WIN64
   std::atomic<uint32_t> unwindinfo_use_count_{0};
 #endif
@@ -66,6 +66,9 @@ class GCInvoker::GCInvokerImpl final : public GarbageCollector {
   cppgc::Platform* platform_;
   cppgc::Heap::StackSupport stack_support_;
   GCTask::Handle gc_task_handle_;
+  // Collection type of the GC scheduled through |gc_task_handle_|.
+  GarbageCollector::Config::CollectionType gc_task_collection_type_ =
+      GarbageCollector::Config::CollectionType::kMajor;
 };
 
 GCInvoker::GCInvokerImpl::GCInvokerImpl(GarbageCollector* collector,
@@ -83,19 +86,33 @@ GCInvoker::GCInvokerImpl::~GCInvokerImpl() {
 
 void GCInvoker::GCInvokerImpl::CollectGarbage(GarbageCollector::Config config) {
   DCHECK_EQ(config.marking_type, cppgc::Heap::MarkingType::kAtomic);
+  // Minor GCs do not support conservative stack scanning and are always
+  // deferred to a non-nestable task unless the stack is known to be empty.
   if ((config.stack_state ==
        GarbageCollector::Config::StackState::kNoHeapPointers) ||
-      (stack_support_ ==
-       cppgc::Heap::StackSupport::kSupportsConservativeStackScan)) {
+      ((stack_support_ ==
+        cppgc::Heap::StackSupport::kSupportsConservativeStackScan) &&
+       (config.collection_type ==
+        GarbageCollector::Config::CollectionType::kMajor))) {
     collector_->CollectGarbage(config);
   } else if (platform_->GetForegroundTaskRunner() &&
              platform_->GetForegroundTaskRunner()->NonNestableTasksEnabled()) {
+    // A pending minor GC is replaced by the requested major GC, which also
+    // collects the young generation.
+    if (gc_task_handle_ &&
+        (gc_task_collection_type_ ==
+         GarbageCollector::Config::CollectionType::kMinor) &&
+        (config.collection_type ==
+         GarbageCollector::Config::CollectionType::kMajor)) {
+      gc_task_handle_.Cancel();
+    }
     if (!gc_task_handle_) {
       // Force a precise GC since it will run in a non-nestable task.
       config.stack_state =
           GarbageCollector::Config::StackState::kNoHeapPointers;
       gc_task_handle_ = GCTask::Post(
           collector_, platform_->GetForegroundTaskRunner().get(), config);
+      gc_task_collection_type_ = config.collection_type;
     }
   }
 }
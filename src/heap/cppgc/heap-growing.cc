@@ -45,11 +45,17 @@ class HeapGrowing::HeapGrowingImpl final
 
   size_t limit_for_atomic_gc() const { return limit_for_atomic_gc_; }
   size_t limit_for_incremental_gc() const { return limit_for_incremental_gc_; }
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t young_generation_size() const { return young_generation_size_; }
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
   void DisableForTesting();
 
  private:
   void ConfigureLimit(size_t allocated_object_size);
+#if defined(CPPGC_YOUNG_GENERATION)
+  bool ShouldTriggerMinorGC(size_t allocated_object_size) const;
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
   GarbageCollector* collector_;
   StatsCollector* stats_collector_;
@@ -57,6 +63,9 @@ class HeapGrowing::HeapGrowingImpl final
   size_t initial_heap_size_ = 1 * kMB;
   size_t limit_for_atomic_gc_ = 0;       // See ConfigureLimit().
   size_t limit_for_incremental_gc_ = 0;  // See ConfigureLimit().
+#if defined(CPPGC_YOUNG_GENERATION)
+  size_t young_generation_size_ = 0;  // See ConfigureLimit().
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
   SingleThreadedHandle gc_task_handle_;
 
@@ -103,13 +112,42 @@ void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
          GarbageCollector::Config::StackState::kMayContainHeapPointers,
          marking_support_, sweeping_support_});
   }
+#if defined(CPPGC_YOUNG_GENERATION)
+  else if (ShouldTriggerMinorGC(allocated_object_size)) {
+    // Minor GCs do not support conservative stack scanning. The GCInvoker
+    // defers them to a non-nestable task.
+    collector_->CollectGarbage(
+        {GarbageCollector::Config::CollectionType::kMinor,
+         GarbageCollector::Config::StackState::kMayContainHeapPointers,
+         GarbageCollector::Config::MarkingType::kAtomic, sweeping_support_});
+  }
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 }
 
 void HeapGrowing::HeapGrowingImpl::ResetAllocatedObjectSize(
     size_t allocated_object_size) {
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Minor GCs do not reclaim old objects. Keep the limits of the major GC to
+  // avoid growing the heap based on a live size that includes old garbage.
+  if (stats_collector_->current_collection_type() ==
+      GarbageCollector::Config::CollectionType::kMinor) {
+    return;
+  }
+#endif  // defined(CPPGC_YOUNG_GENERATION)
   ConfigureLimit(allocated_object_size);
 }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+bool HeapGrowing::HeapGrowingImpl::ShouldTriggerMinorGC(
+    size_t allocated_object_size) const {
+  // Similar to major GCs, minor GCs are not triggered for heaps below the
+  // initial heap size.
+  if (allocated_object_size <= initial_heap_size_) return false;
+  return stats_collector_->allocated_bytes_since_end_of_marking() >
+         static_cast<int64_t>(young_generation_size_);
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
 void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
     size_t allocated_object_size) {
   const size_t size = std::max(allocated_object_size, initial_heap_size_);
@@ -138,6 +176,14 @@ void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
       std::max(minimum_limit_incremental_gc,
                std::min(maximum_limit_incremental_gc,
                         limit_incremental_gc_based_on_allocation_rate));
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Size the young generation such that short-lived objects can be reclaimed
+  // by minor GCs well before an incremental major GC would be started.
+  young_generation_size_ =
+      std::min(kMaxYoungGenerationSize,
+               std::max(kMinLimitIncrease,
+                        (limit_for_incremental_gc_ - size) / 2));
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 }
 
 void HeapGrowing::HeapGrowingImpl::DisableForTesting() {
@@ -161,6 +207,11 @@ size_t HeapGrowing::limit_for_atomic_gc() const {
 size_t HeapGrowing::limit_for_incremental_gc() const {
   return impl_->limit_for_incremental_gc();
 }
+#if defined(CPPGC_YOUNG_GENERATION)
+size_t HeapGrowing::young_generation_size() const {
+  return impl_->young_generation_size();
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
 
 void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
@@ -115,6 +115,12 @@ void Heap::CollectGarbage(Config config) {
 
   if (in_no_gc_scope()) return;
 
+  // A minor GC cannot finalize an already running major GC.
+  if ((config.collection_type == Config::CollectionType::kMinor) &&
+      IsMarking()) {
+    return;
+  }
+
   config_ = config;
 
   if (!IsMarking()) {
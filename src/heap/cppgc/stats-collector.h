@@ -279,6 +279,18 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // Size of live objects in bytes  on the heap. Based on the most recent marked
   // bytes and the bytes allocated since last marking.
   size_t allocated_object_size() const;
+  // Bytes allocated since the end of the most recent marking phase. May be
+  // negative in case objects were explicitly freed.
+  int64_t allocated_bytes_since_end_of_marking() const {
+    return allocated_bytes_since_end_of_marking_;
+  }
+
+  // Returns the type of the garbage collection cycle that is currently in
+  // progress. Should only be called during a garbage collection.
+  CollectionType current_collection_type() const {
+    DCHECK_NE(GarbageCollectionState::kNotRunning, gc_state_);
+    return current_.collection_type;
+  }
 
   // Returns the most recent marked bytes count. Should not be called during
   // marking.
@@ -0,0 +1,108 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/gc-pause-budget.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "src/flags/flags.h"
+#include "src/heap/gc-tracer.h"
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+
+const double GCPauseBudget::kConservativeTimeRatio = 0.8;
+
+// static
+double GCPauseBudget::EstimateIncrementalMarkingStepSizeInMs(
+    double budget_in_ms, double max_step_size_in_ms) {
+  if (budget_in_ms <= 0) return max_step_size_in_ms;
+  return std::min(max_step_size_in_ms, budget_in_ms * kConservativeTimeRatio);
+}
+
+// static
+size_t GCPauseBudget::EstimateMaxYoungGenerationCapacity(
+    double budget_in_ms, double scavenge_speed_in_bytes_per_ms) {
+  if (budget_in_ms <= 0) return std::numeric_limits<size_t>::max();
+  if (scavenge_speed_in_bytes_per_ms == 0) {
+    scavenge_speed_in_bytes_per_ms = kInitialConservativeScavengeSpeed;
+  }
+  const double capacity =
+      scavenge_speed_in_bytes_per_ms * budget_in_ms * kConservativeTimeRatio;
+  if (capacity >= static_cast<double>(std::numeric_limits<size_t>::max())) {
+    return std::numeric_limits<size_t>::max();
+  }
+  return static_cast<size_t>(capacity);
+}
+
+// static
+size_t GCPauseBudget::EstimateMaxEvacuatedBytes(
+    double budget_in_ms, double compaction_speed_in_bytes_per_ms) {
+  if (budget_in_ms <= 0) return std::numeric_limits<size_t>::max();
+  if (compaction_speed_in_bytes_per_ms == 0) {
+    compaction_speed_in_bytes_per_ms = kInitialConservativeCompactionSpeed;
+  }
+  const double evacuated_bytes =
+      compaction_speed_in_bytes_per_ms * budget_in_ms * kConservativeTimeRatio;
+  if (evacuated_bytes >=
+      static_cast<double>(std::numeric_limits<size_t>::max())) {
+    return std::numeric_limits<size_t>::max();
+  }
+  return static_cast<size_t>(evacuated_bytes);
+}
+
+double GCPauseBudget::MaxIncrementalMarkingStepSizeInMs(
+    double max_step_size_in_ms) const {
+  return EstimateIncrementalMarkingStepSizeInMs(budget_in_ms_,
+                                                max_step_size_in_ms);
+}
+
+bool GCPauseBudget::CanGrowYoungGenerationTo(size_t capacity) const {
+  if (!IsEnabled()) return true;
+  const size_t max_capacity = EstimateMaxYoungGenerationCapacity(
+      budget_in_ms_, heap_->tracer()->ScavengeSpeedInBytesPerMillisecond());
+  if (FLAG_trace_gc_pause_budget && capacity > max_capacity) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[GCPauseBudget] Young generation capacity limited to %zuKB "
+        "(requested %zuKB, budget %.1fms)\n",
+        max_capacity / KB, capacity / KB, budget_in_ms_);
+  }
+  return capacity <= max_capacity;
+}
+
+size_t GCPauseBudget::MaxEvacuatedBytes(size_t max_evacuated_bytes,
+                                        size_t min_evacuated_bytes) const {
+  if (!IsEnabled()) return max_evacuated_bytes;
+  const size_t budget_evacuated_bytes = EstimateMaxEvacuatedBytes(
+      budget_in_ms_, heap_->tracer()->CompactionSpeedInBytesPerMillisecond());
+  const size_t result =
+      std::min(max_evacuated_bytes,
+               std::max(min_evacuated_bytes, budget_evacuated_bytes));
+  if (FLAG_trace_gc_pause_budget && result < max_evacuated_bytes) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[GCPauseBudget] Evacuation limited to %zuKB (requested %zuKB, "
+        "budget %.1fms)\n",
+        result / KB, max_evacuated_bytes / KB, budget_in_ms_);
+  }
+  return result;
+}
+
+bool GCPauseBudget::NotifyGCPause(double duration_in_ms) {
+  if (!IsEnabled()) return false;
+  pauses_++;
+  if (duration_in_ms <= budget_in_ms_) return false;
+  budget_misses_++;
+  if (FLAG_trace_gc_pause_budget) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[GCPauseBudget] Pause of %.1fms exceeded budget of %.1fms "
+        "(%zu of %zu pauses)\n",
+        duration_in_ms, budget_in_ms_, budget_misses_, pauses_);
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
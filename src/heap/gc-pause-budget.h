@@ -0,0 +1,81 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_GC_PAUSE_BUDGET_H_
+#define V8_HEAP_GC_PAUSE_BUDGET_H_
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// The pause budget translates an embedder-provided upper bound for main-thread
+// garbage collection pauses into concrete limits for the individual GC
+// heuristics: the size of incremental marking steps and the capacity of the
+// young generation. The limits are derived from the speeds observed by the
+// GCTracer. Pauses that exceed the budget are counted and reported.
+class V8_EXPORT_PRIVATE GCPauseBudget final {
+ public:
+  // If we haven't recorded any scavenges yet, we assume a conservative lower
+  // bound for the scavenge speed.
+  static const size_t kInitialConservativeScavengeSpeed = 1 * MB;
+
+  // If we haven't recorded any compactions yet, we assume a conservative lower
+  // bound for the compaction speed.
+  static const size_t kInitialConservativeCompactionSpeed = 256 * KB;
+
+  // We only use this fraction of the budget for the estimated pause, leaving
+  // room for work that is not covered by the speed estimates.
+  static const double kConservativeTimeRatio;
+
+  GCPauseBudget(Heap* heap, double budget_in_ms)
+      : heap_(heap), budget_in_ms_(budget_in_ms) {}
+  GCPauseBudget(const GCPauseBudget&) = delete;
+  GCPauseBudget& operator=(const GCPauseBudget&) = delete;
+
+  bool IsEnabled() const { return budget_in_ms_ > 0; }
+  double budget_in_ms() const { return budget_in_ms_; }
+
+  // Returns the maximum duration of a single incremental marking step.
+  double MaxIncrementalMarkingStepSizeInMs(double max_step_size_in_ms) const;
+
+  // Returns true if a young generation of the given capacity is expected to
+  // be collected within the budget.
+  bool CanGrowYoungGenerationTo(size_t capacity) const;
+
+  // Limits |max_evacuated_bytes| to the live bytes that can be evacuated from
+  // evacuation candidates within the budget. At least |min_evacuated_bytes|
+  // are allowed so that compaction makes progress over consecutive GCs.
+  size_t MaxEvacuatedBytes(size_t max_evacuated_bytes,
+                           size_t min_evacuated_bytes) const;
+
+  // Records the duration of a main-thread GC pause. Returns true if the pause
+  // exceeded the budget.
+  bool NotifyGCPause(double duration_in_ms);
+
+  size_t pauses() const { return pauses_; }
+  size_t budget_misses() const { return budget_misses_; }
+
+  static double EstimateIncrementalMarkingStepSizeInMs(
+      double budget_in_ms, double max_step_size_in_ms);
+
+  static size_t EstimateMaxYoungGenerationCapacity(
+      double budget_in_ms, double scavenge_speed_in_bytes_per_ms);
+
+  static size_t EstimateMaxEvacuatedBytes(
+      double budget_in_ms, double compaction_speed_in_bytes_per_ms);
+
+ private:
+  Heap* const heap_;
+  const double budget_in_ms_;
+  size_t pauses_ = 0;
+  size_t budget_misses_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_GC_PAUSE_BUDGET_H_
@@ -14,6 +14,7 @@
 #include "src/execution/thread-id.h"
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/cppgc/metric-recorder.h"
+#include "src/heap/gc-pause-budget.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/spaces.h"
@@ -410,6 +411,10 @@ void GCTracer::Stop(GarbageCollector collector) {
 
   heap_->UpdateTotalGCTime(duration);
 
+  if (heap_->gc_pause_budget()->NotifyGCPause(duration)) {
+    ReportPauseBudgetExceededToRecorder(duration);
+  }
+
   if ((current_.type == Event::SCAVENGER ||
        current_.type == Event::MINOR_MARK_COMPACTOR) &&
       FLAG_trace_gc_ignore_scavenger)
@@ -690,6 +695,8 @@ void GCTracer::PrintNVP() const {
           "mark=%.2f "
           "mark.seed=%.2f "
           "mark.roots=%.2f "
+          "mark.parallel=%.2f "
+          "mark.drain=%.2f "
           "mark.weak=%.2f "
           "mark.global_handles=%.2f "
           "clear=%.2f "
@@ -714,6 +721,8 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::MINOR_MC_MARK],
           current_.scopes[Scope::MINOR_MC_MARK_SEED],
           current_.scopes[Scope::MINOR_MC_MARK_ROOTS],
+          current_.scopes[Scope::MINOR_MC_MARK_PARALLEL],
+          current_.scopes[Scope::MINOR_MC_MARK_DRAIN],
           current_.scopes[Scope::MINOR_MC_MARK_WEAK],
           current_.scopes[Scope::MINOR_MC_MARK_GLOBAL_HANDLES],
           current_.scopes[Scope::MINOR_MC_CLEAR],
@@ -1172,6 +1181,8 @@ void GCTracer::FetchBackgroundMinorGCCounters() {
   heap_->isolate()->counters()->background_scavenger()->AddSample(
       static_cast<int>(
           current_.scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL]));
+  heap_->isolate()->counters()->background_minor_mc_marking()->AddSample(
+      static_cast<int>(current_.scopes[Scope::MINOR_MC_BACKGROUND_MARKING]));
 }
 
 void GCTracer::FetchBackgroundGeneralCounters() {
@@ -1249,6 +1260,16 @@ void GCTracer::RecordGCPhasesHistograms(TimedHistogram* gc_timer) {
         static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL]));
     counters->gc_scavenger_scavenge_roots()->AddSample(
         static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_ROOTS]));
+  } else if (gc_timer == counters->gc_minor_mc()) {
+    counters->gc_minor_mc_mark()->AddSample(
+        static_cast<int>(current_.scopes[Scope::MINOR_MC_MARK]));
+    counters->gc_minor_mc_mark_main()->AddSample(
+        static_cast<int>(current_.scopes[Scope::MINOR_MC_MARK_PARALLEL] +
+                         current_.scopes[Scope::MINOR_MC_MARK_DRAIN]));
+    counters->gc_minor_mc_mark_seed()->AddSample(
+        static_cast<int>(current_.scopes[Scope::MINOR_MC_MARK_SEED]));
+    counters->gc_minor_mc_evacuate()->AddSample(
+        static_cast<int>(current_.scopes[Scope::MINOR_MC_EVACUATE]));
   }
 }
 
@@ -1443,5 +1464,21 @@ void GCTracer::ReportIncrementalMarkingStepToRecorder() {
   }
 }
 
+void GCTracer::ReportPauseBudgetExceededToRecorder(double duration) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (!recorder->HasEmbedderRecorder()) return;
+  v8::metrics::GarbageCollectionPauseBudgetExceeded event;
+  event.is_young = current_.type == Event::SCAVENGER ||
+                   current_.type == Event::MINOR_MARK_COMPACTOR;
+  event.wall_clock_duration_in_us = static_cast<int64_t>(
+      duration * base::Time::kMicrosecondsPerMillisecond);
+  event.budget_in_us =
+      static_cast<int64_t>(heap_->gc_pause_budget()->budget_in_ms() *
+                           base::Time::kMicrosecondsPerMillisecond);
+  recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -419,6 +419,7 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void ReportFullCycleToRecorder();
   void ReportIncrementalMarkingStepToRecorder();
+  void ReportPauseBudgetExceededToRecorder(double duration);
 
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
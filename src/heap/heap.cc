@@ -47,6 +47,7 @@
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/finalization-registry-cleanup-task.h"
 #include "src/heap/gc-idle-time-handler.h"
+#include "src/heap/gc-pause-budget.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-controller.h"
 #include "src/heap/heap-write-barrier-inl.h"
@@ -400,6 +401,31 @@ size_t Heap::CommittedMemoryExecutable() {
   return static_cast<size_t>(memory_allocator()->SizeExecutable());
 }
 
+size_t Heap::CommittedHugePageBackedMemory() {
+  if (!HasBeenSetUp() || !FLAG_huge_pages) return 0;
+
+  size_t total = 0;
+  {
+    base::MutexGuard guard(old_space()->mutex());
+    for (Page* page : *old_space()) {
+      if (memory_allocator()->IsHugePageBacked(page->address())) {
+        total += page->size();
+      }
+    }
+  }
+
+  const base::AddressRegion code_region =
+      code_range_ ? code_range_->huge_page_region() : base::AddressRegion();
+  if (!code_region.is_empty()) {
+    base::MutexGuard guard(code_space()->mutex());
+    for (Page* page : *code_space()) {
+      if (code_region.contains(page->address())) total += page->size();
+    }
+  }
+
+  return total;
+}
+
 void Heap::UpdateMaximumCommitted() {
   if (!HasBeenSetUp()) return;
 
@@ -937,6 +963,7 @@ void Heap::GarbageCollectionPrologue() {
     retaining_root_.clear();
   }
   memory_allocator()->unmapper()->PrepareForGC();
+  if (ShouldReduceMemory()) memory_allocator()->ReleaseLargePageCache();
 }
 
 void Heap::GarbageCollectionPrologueInSafepoint() {
@@ -1440,6 +1467,9 @@ TimedHistogram* Heap::GCTypePriorityTimer(GarbageCollector collector) {
 }
 
 TimedHistogram* Heap::GCTypeTimer(GarbageCollector collector) {
+  if (collector == MINOR_MARK_COMPACTOR) {
+    return isolate_->counters()->gc_minor_mc();
+  }
   if (IsYoungGenerationCollector(collector)) {
     return isolate_->counters()->gc_scavenger();
   }
@@ -2539,9 +2569,14 @@ void Heap::MarkCompactPrologue() {
 
 void Heap::CheckNewSpaceExpansionCriteria() {
   if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
-      survived_since_last_expansion_ > new_space_->TotalCapacity()) {
-    // Grow the size of new space if there is room to grow, and enough data
-    // has survived scavenge since the last expansion.
+      survived_since_last_expansion_ > new_space_->TotalCapacity() &&
+      gc_pause_budget_->CanGrowYoungGenerationTo(std::min(
+          new_space_->MaximumCapacity(),
+          static_cast<size_t>(FLAG_semi_space_growth_factor) *
+              new_space_->TotalCapacity()))) {
+    // Grow the size of new space if there is room to grow, enough data has
+    // survived scavenge since the last expansion, and the grown young
+    // generation can still be collected within the GC pause budget.
     new_space_->Grow();
     survived_since_last_expansion_ = 0;
   }
@@ -4115,6 +4150,7 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
 void Heap::EagerlyFreeExternalMemory() {
   array_buffer_sweeper()->EnsureFinished();
   memory_allocator()->unmapper()->EnsureUnmappingCompleted();
+  memory_allocator()->ReleaseLargePageCache();
 }
 
 void Heap::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
@@ -5073,6 +5109,11 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
 
   code_range_size_ = constraints.code_range_size_in_bytes();
 
+  gc_pause_budget_in_ms_ = constraints.max_gc_pause_time_in_ms();
+  if (FLAG_gc_pause_budget > 0) {
+    gc_pause_budget_in_ms_ = FLAG_gc_pause_budget;
+  }
+
   configured_ = true;
 }
 
@@ -5641,6 +5682,7 @@ void Heap::SetUpSpaces() {
 #endif  // ENABLE_MINOR_MC
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
+  gc_pause_budget_.reset(new GCPauseBudget(this, gc_pause_budget_in_ms_));
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   memory_reducer_.reset(new MemoryReducer(this));
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
@@ -5945,6 +5987,7 @@ void Heap::TearDown() {
   concurrent_marking_.reset();
 
   gc_idle_time_handler_.reset();
+  gc_pause_budget_.reset();
 
   memory_measurement_.reset();
 
@@ -7031,6 +7074,10 @@ Code Heap::GcSafeFindCodeForInnerPointer(Address inner_pointer) {
     // starting after the inner pointer.
     Page* page = Page::FromAddress(inner_pointer);
 
+    // Code pages may be swept concurrently, which rebuilds the code object
+    // registry of the page.
+    base::Optional<base::MutexGuard> guard;
+    if (!page->SweepingDone()) guard.emplace(page->mutex());
     Address start =
         page->GetCodeObjectRegistry()->GetCodeObjectStartFromInnerAddress(
             inner_pointer);
@@ -7214,6 +7261,9 @@ void Heap::GenerationalBarrierForCodeSlow(Code host, RelocInfo* rinfo,
   }
   uintptr_t offset = addr - source_page->address();
   DCHECK_LT(offset, static_cast<uintptr_t>(TypedSlotSet::kMaxOffset));
+  // Code pages may be swept concurrently, which clears invalid typed slots.
+  base::Optional<base::MutexGuard> guard;
+  if (!source_page->SweepingDone()) guard.emplace(source_page->mutex());
   RememberedSet<OLD_TO_NEW>::InsertTyped(source_page, slot_type,
                                          static_cast<uint32_t>(offset));
 }
@@ -76,6 +76,7 @@ class ConcurrentAllocator;
 class ConcurrentMarking;
 class CppHeap;
 class GCIdleTimeHandler;
+class GCPauseBudget;
 class GCIdleTimeHeapState;
 class GCTracer;
 template <typename T>
@@ -1371,6 +1372,10 @@ class Heap {
   // Returns the amount of executable memory currently committed for the heap.
   size_t CommittedMemoryExecutable();
 
+  // Returns the amount of old space and code memory currently committed in
+  // regions that are backed by huge pages (see FLAG_huge_pages).
+  size_t CommittedHugePageBackedMemory();
+
   // Returns the amount of phyical memory currently committed for the heap.
   size_t CommittedPhysicalMemory();
 
@@ -2009,6 +2014,8 @@ class Heap {
 
   MemoryReducer* memory_reducer() { return memory_reducer_.get(); }
 
+  GCPauseBudget* gc_pause_budget() { return gc_pause_budget_.get(); }
+
   // For some webpages RAIL mode does not switch from PERFORMANCE_LOAD.
   // This constant limits the effect of load RAIL mode on GC.
   // The value is arbitrary and chosen as the largest load time observed in
@@ -2182,6 +2189,7 @@ class Heap {
   // These limits are initialized in Heap::ConfigureHeap based on the resource
   // constraints and flags.
   size_t code_range_size_ = 0;
+  double gc_pause_budget_in_ms_ = 0;
   size_t max_semi_space_size_ = 0;
   size_t initial_semispace_size_ = 0;
   // Full garbage collections can be skipped if the old generation size
@@ -2370,6 +2378,7 @@ class Heap {
   std::unique_ptr<IncrementalMarking> incremental_marking_;
   std::unique_ptr<ConcurrentMarking> concurrent_marking_;
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
+  std::unique_ptr<GCPauseBudget> gc_pause_budget_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
   std::unique_ptr<ObjectStats> live_object_stats_;
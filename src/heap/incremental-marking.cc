@@ -9,6 +9,7 @@
 #include "src/heap/concurrent-marking.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/gc-idle-time-handler.h"
+#include "src/heap/gc-pause-budget.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking-inl.h"
@@ -928,6 +929,10 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
           "[IncrementalMarking] Marking speed %.fKB/ms\n",
           heap()->tracer()->IncrementalMarkingSpeedInBytesPerMillisecond());
     }
+    // Keep the step within the GC pause budget if one is set.
+    max_step_size_in_ms =
+        heap()->gc_pause_budget()->MaxIncrementalMarkingStepSizeInMs(
+            max_step_size_in_ms);
     // The first step after Scavenge will see many allocated bytes.
     // Cap the step size to distribute the marking work more uniformly.
     const double marking_speed =
@@ -961,6 +966,13 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
     bytes_marked_ += v8_bytes_processed;
     combined_result = CombineStepResults(v8_result, embedder_result);
 
+    if (combined_result == StepResult::kNoImmediateWork &&
+        collector_->ProcessEphemeronsIncrementally()) {
+      // Revisiting ephemerons may discover new objects. Postpone finalization
+      // to keep this work out of the atomic pause.
+      combined_result = StepResult::kMoreWorkRemaining;
+    }
+
     if (combined_result == StepResult::kNoImmediateWork) {
       if (!finalize_marking_completed_) {
         FinalizeMarking(action);
@@ -0,0 +1,73 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/large-page-cache.h"
+
+#include <algorithm>
+
+#include "src/base/bits.h"
+#include "src/flags/flags.h"
+
+namespace v8 {
+namespace internal {
+
+LargePageCache::~LargePageCache() { ReleaseAll(); }
+
+// static
+int LargePageCache::SizeClassFor(size_t size) {
+  DCHECK_LE(size, kMaxReservationSize);
+  const int size_log2 =
+      base::bits::WhichPowerOfTwo(base::bits::RoundUpToPowerOfTwo(size));
+  return std::max(size_log2, kMinSizeClassLog2) - kMinSizeClassLog2;
+}
+
+bool LargePageCache::Add(VirtualMemory* reservation) {
+  DCHECK(reservation->IsReserved());
+  const size_t size = reservation->size();
+  if (size > kMaxReservationSize) return false;
+  base::MutexGuard guard(&mutex_);
+  if (size_ + size > FLAG_large_page_cache_size * MB) return false;
+  size_classes_[SizeClassFor(size)].push_back(std::move(*reservation));
+  size_ += size;
+  return true;
+}
+
+VirtualMemory LargePageCache::TryGet(size_t size) {
+  if (size > kMaxReservationSize) return VirtualMemory();
+  base::MutexGuard guard(&mutex_);
+  std::vector<VirtualMemory>& size_class = size_classes_[SizeClassFor(size)];
+  for (auto it = size_class.begin(); it != size_class.end(); ++it) {
+    if (it->size() < size) continue;
+    VirtualMemory reservation = std::move(*it);
+    size_class.erase(it);
+    size_ -= reservation.size();
+    return reservation;
+  }
+  return VirtualMemory();
+}
+
+void LargePageCache::ReleaseAll() {
+  std::vector<VirtualMemory> reservations;
+  {
+    base::MutexGuard guard(&mutex_);
+    for (std::vector<VirtualMemory>& size_class : size_classes_) {
+      for (VirtualMemory& reservation : size_class) {
+        reservations.push_back(std::move(reservation));
+      }
+      size_class.clear();
+    }
+    size_ = 0;
+  }
+  for (VirtualMemory& reservation : reservations) {
+    reservation.Free();
+  }
+}
+
+size_t LargePageCache::CommittedMemory() {
+  base::MutexGuard guard(&mutex_);
+  return size_;
+}
+
+}  // namespace internal
+}  // namespace v8
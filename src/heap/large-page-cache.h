@@ -0,0 +1,66 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_LARGE_PAGE_CACHE_H_
+#define V8_HEAP_LARGE_PAGE_CACHE_H_
+
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/utils/allocation.h"
+
+namespace v8 {
+namespace internal {
+
+// Keeps the committed reservations of recently freed non-executable large
+// pages so that large objects of similar size can be allocated without
+// mapping fresh memory. Reservations are bucketed by power-of-two size
+// classes. A cached reservation is handed out for any request of the same
+// size class that fits into it, i.e., at most half of a reused reservation
+// is unused. The unused tail is released when the large object space shrinks
+// its pages after the next full GC.
+class V8_EXPORT_PRIVATE LargePageCache final {
+ public:
+  // Reservations of up to this size are cached.
+  static constexpr size_t kMaxReservationSize = size_t{4} * MB;
+
+  LargePageCache() = default;
+  ~LargePageCache();
+  LargePageCache(const LargePageCache&) = delete;
+  LargePageCache& operator=(const LargePageCache&) = delete;
+
+  // Takes ownership of |reservation| if it fits into the cache. Returns false
+  // if the reservation is not cacheable or the cache is full in which case the
+  // caller keeps ownership.
+  bool Add(VirtualMemory* reservation);
+
+  // Returns a committed reservation of at least |size| bytes or an
+  // unreserved VirtualMemory if there is none.
+  VirtualMemory TryGet(size_t size);
+
+  // Frees all cached reservations.
+  void ReleaseAll();
+
+  // Returns the committed memory held by the cache in bytes.
+  size_t CommittedMemory();
+
+ private:
+  static constexpr int kMinSizeClassLog2 = kPageSizeBits;
+  static constexpr int kMaxSizeClassLog2 = 22;
+  static constexpr int kNumberOfSizeClasses =
+      kMaxSizeClassLog2 - kMinSizeClassLog2 + 1;
+  STATIC_ASSERT(size_t{1} << kMaxSizeClassLog2 == kMaxReservationSize);
+
+  static int SizeClassFor(size_t size);
+
+  base::Mutex mutex_;
+  std::vector<VirtualMemory> size_classes_[kNumberOfSizeClasses];
+  size_t size_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_LARGE_PAGE_CACHE_H_
@@ -58,7 +58,10 @@ Address LargePage::GetAddressToShrink(Address object_address,
   }
   size_t used_size = ::RoundUp((object_address - address()) + object_size,
                                MemoryAllocator::GetCommitPageSize());
-  if (used_size < CommittedPhysicalMemory()) {
+  // Compare against the committed size of the page. On platforms with lazy
+  // commits the physical size only reports the high water mark, which does not
+  // cover the unused tail of a page reused from the large page cache.
+  if (used_size < size()) {
     return address() + used_size;
   }
   return 0;
@@ -19,6 +19,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/code-object-registry.h"
+#include "src/heap/gc-pause-budget.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/index-generator.h"
@@ -559,6 +560,8 @@ void MarkCompactCollector::StartMarking() {
     }
   }
   code_flush_mode_ = Heap::GetCodeFlushMode(isolate());
+  incremental_ephemeron_iterations_ = 0;
+  incremental_ephemeron_marked_ = false;
   marking_worklists()->CreateContextWorklists(contexts);
   local_marking_worklists_ =
       std::make_unique<MarkingWorklists::Local>(marking_worklists());
@@ -721,6 +724,16 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
   }
+
+  // Bound the work of the atomic pause by the pause budget. Pages that do not
+  // fit are left for subsequent GCs which keeps compacting the space
+  // incrementally, a single area at least per GC. Memory-reducing GCs are
+  // exempt as they are the last resort to release memory.
+  if (!heap()->ShouldReduceMemory()) {
+    *max_evacuated_bytes =
+        heap()->gc_pause_budget()->MaxEvacuatedBytes(*max_evacuated_bytes,
+                                                     area_size);
+  }
 }
 
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
@@ -1989,6 +2002,75 @@ void MarkCompactCollector::ProcessEphemeronMarking() {
   CHECK(heap()->local_embedder_heap_tracer()->IsRemoteTracingDone());
 }
 
+bool MarkCompactCollector::ProcessEphemeronsIncrementally() {
+  if (!FLAG_incremental_ephemeron_marking) return false;
+
+  static constexpr int kMaxEphemeronsPerStep = 1024;
+  int processed = 0;
+  Ephemeron ephemeron;
+
+  // Ephemerons discovered while visiting hash tables in incremental steps are
+  // processed right away instead of in the atomic pause.
+  weak_objects_.discovered_ephemerons.FlushToGlobal(kMainThreadTask);
+  while (processed < kMaxEphemeronsPerStep &&
+         weak_objects_.discovered_ephemerons.Pop(kMainThreadTask,
+                                                 &ephemeron)) {
+    ++processed;
+    if (ProcessEphemeron(ephemeron.key, ephemeron.value)) {
+      incremental_ephemeron_marked_ = true;
+    }
+  }
+
+  if (processed == 0 &&
+      weak_objects_.current_ephemerons.IsGlobalPoolEmpty() &&
+      weak_objects_.current_ephemerons.IsLocalEmpty(kMainThreadTask)) {
+    // Concurrent marking tasks flush their local ephemeron buffers and report
+    // whether they marked a value when they are preempted.
+    ConcurrentMarking::PauseScope pause_scope(heap()->concurrent_marking());
+    if (!weak_objects_.current_ephemerons.IsEmpty() ||
+        !weak_objects_.discovered_ephemerons.IsEmpty()) {
+      return true;
+    }
+
+    // The previous iteration is complete. Only start another one if it made
+    // progress, otherwise the atomic pause would not do better either.
+    const bool made_progress =
+        incremental_ephemeron_iterations_ == 0 ||
+        incremental_ephemeron_marked_ ||
+        heap()->concurrent_marking()->ephemeron_marked();
+    if (!made_progress ||
+        incremental_ephemeron_iterations_ >=
+            FLAG_ephemeron_fixpoint_iterations) {
+      return false;
+    }
+
+    weak_objects_.next_ephemerons.FlushToGlobal(kMainThreadTask);
+    if (weak_objects_.next_ephemerons.IsEmpty()) return false;
+
+    // Move ephemerons from next_ephemerons into current_ephemerons where
+    // they are revisited by concurrent marking tasks and incremental steps.
+    weak_objects_.current_ephemerons.Swap(weak_objects_.next_ephemerons);
+    heap()->concurrent_marking()->set_ephemeron_marked(false);
+    incremental_ephemeron_marked_ = false;
+    ++incremental_ephemeron_iterations_;
+  }
+
+  while (processed < kMaxEphemeronsPerStep &&
+         weak_objects_.current_ephemerons.Pop(kMainThreadTask, &ephemeron)) {
+    ++processed;
+    if (ProcessEphemeron(ephemeron.key, ephemeron.value)) {
+      incremental_ephemeron_marked_ = true;
+    }
+  }
+
+  // The atomic pause swaps the ephemeron worklists which requires empty local
+  // buffers.
+  weak_objects_.current_ephemerons.FlushToGlobal(kMainThreadTask);
+  weak_objects_.next_ephemerons.FlushToGlobal(kMainThreadTask);
+  weak_objects_.discovered_ephemerons.FlushToGlobal(kMainThreadTask);
+  return true;
+}
+
 void MarkCompactCollector::ProcessTopOptimizedFrame(ObjectVisitor* visitor,
                                                     Isolate* isolate) {
   for (StackFrameIterator it(isolate, isolate->thread_local_top()); !it.done();
@@ -5136,18 +5218,19 @@ class YoungGenerationMarkingJob : public v8::JobTask {
   YoungGenerationMarkingJob(
       Isolate* isolate, MinorMarkCompactCollector* collector,
       MinorMarkCompactCollector::MarkingWorklist* global_worklist,
-      std::vector<PageMarkingItem> marking_items)
+      std::vector<PageMarkingItem> marking_items,
+      GCTracer::Scope::ScopeId main_thread_scope)
       : isolate_(isolate),
         collector_(collector),
         global_worklist_(global_worklist),
         marking_items_(std::move(marking_items)),
         remaining_marking_items_(marking_items_.size()),
-        generator_(marking_items_.size()) {}
+        generator_(marking_items_.size()),
+        main_thread_scope_(main_thread_scope) {}
 
   void Run(JobDelegate* delegate) override {
     if (delegate->IsJoiningThread()) {
-      TRACE_GC(collector_->heap()->tracer(),
-               GCTracer::Scope::MINOR_MC_MARK_PARALLEL);
+      TRACE_GC(collector_->heap()->tracer(), main_thread_scope_);
       ProcessItems(delegate);
     } else {
       TRACE_GC_EPOCH(collector_->heap()->tracer(),
@@ -5208,6 +5291,8 @@ class YoungGenerationMarkingJob : public v8::JobTask {
   std::vector<PageMarkingItem> marking_items_;
   std::atomic_size_t remaining_marking_items_{0};
   IndexGenerator generator_;
+  // Scope that the main thread's share of the marking is accounted to.
+  const GCTracer::Scope::ScopeId main_thread_scope_;
 };
 
 void MinorMarkCompactCollector::MarkRootSetInParallel(
@@ -5246,7 +5331,8 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
       V8::GetCurrentPlatform()
           ->PostJob(v8::TaskPriority::kUserBlocking,
                     std::make_unique<YoungGenerationMarkingJob>(
-                        isolate(), this, worklist(), std::move(marking_items)))
+                        isolate(), this, worklist(), std::move(marking_items),
+                        GCTracer::Scope::MINOR_MC_MARK_PARALLEL))
           ->Join();
 
       DCHECK(worklist()->IsEmpty());
@@ -5263,7 +5349,7 @@ void MinorMarkCompactCollector::MarkLiveObjects() {
 
   MarkRootSetInParallel(&root_visitor);
 
-  // Mark rest on the main thread.
+  // Mark rest.
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARK_WEAK);
     DrainMarkingWorklist();
@@ -5286,6 +5372,23 @@ void MinorMarkCompactCollector::MarkLiveObjects() {
 }
 
 void MinorMarkCompactCollector::DrainMarkingWorklist() {
+  if (FLAG_minor_mc_parallel_marking) {
+    // Objects discovered by the main thread (e.g. through global handles) may
+    // form large transitive closures. Hand them to the marking job so that
+    // they are processed in parallel instead of on the main thread only.
+    worklist()->FlushToGlobal(kMainMarker);
+    if (!worklist()->IsEmpty()) {
+      V8::GetCurrentPlatform()
+          ->PostJob(v8::TaskPriority::kUserBlocking,
+                    std::make_unique<YoungGenerationMarkingJob>(
+                        isolate(), this, worklist(),
+                        std::vector<PageMarkingItem>(),
+                        GCTracer::Scope::MINOR_MC_MARK_DRAIN))
+          ->Join();
+    }
+    DCHECK(worklist()->IsEmpty());
+    return;
+  }
   MarkingWorklist::View marking_worklist(worklist(), kMainMarker);
   HeapObject object;
   while (marking_worklist.Pop(&object)) {
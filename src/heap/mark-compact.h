@@ -624,6 +624,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // Marks object reachable from harmony weak maps and wrapper tracing.
   void ProcessEphemeronMarking();
 
+  // Runs ephemeron fixpoint iterations during incremental marking. Returns
+  // true if ephemerons are still being revisited and finalization of
+  // incremental marking should be postponed.
+  bool ProcessEphemeronsIncrementally();
+
   // If the call-site of the top optimized code was not prepared for
   // deoptimization, then treat embedded pointers in the code as strong as
   // otherwise they can die and try to deoptimize the underlying code.
@@ -771,6 +776,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   WeakObjects weak_objects_;
   EphemeronMarking ephemeron_marking_;
 
+  // State of the ephemeron fixpoint iterations performed during incremental
+  // marking.
+  int incremental_ephemeron_iterations_ = 0;
+  bool incremental_ephemeron_marked_ = false;
+
   std::unique_ptr<MarkingVisitor> marking_visitor_;
   std::unique_ptr<MarkingWorklists::Local> local_marking_worklists_;
   NativeContextInferrer native_context_inferrer_;
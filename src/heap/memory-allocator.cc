@@ -13,6 +13,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/memory-chunk.h"
+#include "src/heap/page-pool.h"
 #include "src/heap/read-only-spaces.h"
 #include "src/logging/log.h"
 #include "src/utils/allocation.h"
@@ -37,10 +38,50 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
       highest_ever_allocated_(kNullAddress),
       unmapper_(isolate->heap(), this) {
   DCHECK_NOT_NULL(code_page_allocator);
+  if (FLAG_huge_pages) InitializeHugePageRegion();
+}
+
+void MemoryAllocator::InitializeHugePageRegion() {
+  const size_t huge_page_size = base::OS::HugePageSize();
+  if (huge_page_size == 0) return;
+  DCHECK(IsAligned(huge_page_size, MemoryChunk::kAlignment));
+  const size_t size =
+      RoundUp(std::min(FLAG_huge_page_region_size * MB, capacity_),
+              huge_page_size);
+  if (size == 0) return;
+  void* hint = AlignedAddress(isolate_->heap()->GetRandomMmapAddr(),
+                              huge_page_size);
+  VirtualMemory reservation(data_page_allocator_, size, hint, huge_page_size);
+  if (!reservation.IsReserved()) return;
+  DCHECK(IsAligned(reservation.address(), huge_page_size));
+  // The advice may be rejected, e.g. if transparent huge pages are disabled.
+  // The region is used regardless, its pages are allocated as usual then.
+  huge_pages_advised_ =
+      AdviseHugePages(reservation.region()).size() == reservation.size();
+  huge_page_region_ = reservation.region();
+  huge_page_reservation_ = std::move(reservation);
+  huge_page_allocator_ = std::make_unique<base::BoundedPageAllocator>(
+      data_page_allocator_, huge_page_region_.begin(),
+      huge_page_region_.size(), MemoryChunk::kPageSize);
+}
+
+bool MemoryAllocator::ShouldAllocateInHugePageRegion(BaseSpace* owner,
+                                                     size_t chunk_size) {
+  return huge_page_allocator_ && owner != nullptr &&
+         owner->identity() == OLD_SPACE &&
+         chunk_size == static_cast<size_t>(MemoryChunk::kPageSize);
 }
 
 void MemoryAllocator::TearDown() {
   unmapper()->TearDown();
+  ReleaseLargePageCache();
+
+  huge_page_allocator_.reset();
+  huge_page_region_ = base::AddressRegion();
+  huge_pages_advised_ = false;
+  if (huge_page_reservation_.IsReserved()) {
+    huge_page_reservation_.Free();
+  }
 
   // Check that spaces were torn down before MemoryAllocator.
   DCHECK_EQ(size_, 0u);
@@ -206,7 +247,7 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   for (auto& chunk : chunks_[kNonRegular]) {
     sum += chunk->size();
   }
-  return sum;
+  return sum + allocator_->large_page_cache_.CommittedMemory();
 }
 
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation) {
@@ -235,8 +276,8 @@ void MemoryAllocator::FreeMemory(v8::PageAllocator* page_allocator,
 
 Address MemoryAllocator::AllocateAlignedMemory(
     size_t reserve_size, size_t commit_size, size_t alignment,
-    Executability executable, void* hint, VirtualMemory* controller) {
-  v8::PageAllocator* page_allocator = this->page_allocator(executable);
+    Executability executable, v8::PageAllocator* page_allocator, void* hint,
+    VirtualMemory* controller) {
   DCHECK(commit_size <= reserve_size);
   VirtualMemory reservation(page_allocator, reserve_size, hint, alignment);
   if (!reservation.IsReserved()) return kNullAddress;
@@ -323,9 +364,10 @@ V8_EXPORT_PRIVATE BasicMemoryChunk* MemoryAllocator::AllocateBasicChunk(
     size_t commit_size = ::RoundUp(
         MemoryChunkLayout::CodePageGuardStartOffset() + commit_area_size,
         GetCommitPageSize());
-    base =
-        AllocateAlignedMemory(chunk_size, commit_size, MemoryChunk::kAlignment,
-                              executable, address_hint, &reservation);
+    base = AllocateAlignedMemory(chunk_size, commit_size,
+                                 MemoryChunk::kAlignment, executable,
+                                 page_allocator(executable), address_hint,
+                                 &reservation);
     if (base == kNullAddress) return nullptr;
     // Update executable memory size.
     size_executable_ += reservation.size();
@@ -345,9 +387,18 @@ V8_EXPORT_PRIVATE BasicMemoryChunk* MemoryAllocator::AllocateBasicChunk(
     size_t commit_size = ::RoundUp(
         MemoryChunkLayout::ObjectStartOffsetInDataPage() + commit_area_size,
         GetCommitPageSize());
-    base =
-        AllocateAlignedMemory(chunk_size, commit_size, MemoryChunk::kAlignment,
-                              executable, address_hint, &reservation);
+    if (ShouldAllocateInHugePageRegion(owner, chunk_size)) {
+      base = AllocateAlignedMemory(chunk_size, commit_size,
+                                   MemoryChunk::kAlignment, executable,
+                                   huge_page_allocator_.get(), nullptr,
+                                   &reservation);
+    }
+    if (base == kNullAddress) {
+      base = AllocateAlignedMemory(chunk_size, commit_size,
+                                   MemoryChunk::kAlignment, executable,
+                                   page_allocator(executable), address_hint,
+                                   &reservation);
+    }
 
     if (base == kNullAddress) return nullptr;
 
@@ -497,12 +548,46 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
   VirtualMemory* reservation = chunk->reserved_memory();
   if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
     UncommitMemory(reservation);
-  } else {
+  } else if (!TryReturnToPagePool(chunk) &&
+             !TryReturnToLargePageCache(chunk)) {
     DCHECK(reservation->IsReserved());
     reservation->Free();
   }
 }
 
+bool MemoryAllocator::TryReturnToPagePool(MemoryChunk* chunk) {
+  PagePool* pool = PagePool::GetProcessWidePagePool();
+  VirtualMemory* reservation = chunk->reserved_memory();
+  if (chunk->executable() == EXECUTABLE || !reservation->IsReserved() ||
+      reservation->address() != chunk->address() ||
+      reservation->size() != static_cast<size_t>(MemoryChunk::kPageSize) ||
+      !pool->CanPool(reservation->page_allocator())) {
+    return false;
+  }
+  // The reservation is part of the chunk header and cannot be accessed
+  // after uncommitting the memory.
+  const Address page = reservation->address();
+  if (!UncommitMemory(reservation)) return false;
+  if (!pool->Add(page)) {
+    FreeMemory(pool->page_allocator(), page,
+               static_cast<size_t>(MemoryChunk::kPageSize));
+  }
+  return true;
+}
+
+bool MemoryAllocator::TryReturnToLargePageCache(MemoryChunk* chunk) {
+  if (!chunk->IsLargePage() || chunk->executable() == EXECUTABLE ||
+      FLAG_large_page_cache_size == 0) {
+    return false;
+  }
+  VirtualMemory* reservation = chunk->reserved_memory();
+  if (!reservation->IsReserved() ||
+      reservation->address() != chunk->address()) {
+    return false;
+  }
+  return large_page_cache_.Add(reservation);
+}
+
 template <MemoryAllocator::FreeMode mode>
 void MemoryAllocator::Free(MemoryChunk* chunk) {
   switch (mode) {
@@ -513,8 +598,11 @@ void MemoryAllocator::Free(MemoryChunk* chunk) {
     case kAlreadyPooled:
       // Pooled pages cannot be touched anymore as their memory is uncommitted.
       // Pooled pages are not-executable.
-      FreeMemory(data_page_allocator(), chunk->address(),
-                 static_cast<size_t>(MemoryChunk::kPageSize));
+      if (!PagePool::GetProcessWidePagePool()->CanPool(data_page_allocator()) ||
+          !PagePool::GetProcessWidePagePool()->Add(chunk->address())) {
+        FreeMemory(data_page_allocator(), chunk->address(),
+                   static_cast<size_t>(MemoryChunk::kPageSize));
+      }
       break;
     case kPooledAndQueue:
       DCHECK_EQ(chunk->size(), static_cast<size_t>(MemoryChunk::kPageSize));
@@ -551,6 +639,13 @@ Page* MemoryAllocator::AllocatePage(size_t size, SpaceType* owner,
                             owner->identity())));
     DCHECK_EQ(executable, NOT_EXECUTABLE);
     chunk = AllocatePagePooled(owner);
+  } else if (executable == NOT_EXECUTABLE &&
+             owner->identity() != CODE_SPACE &&
+             size == static_cast<size_t>(
+                         MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
+                             owner->identity())) &&
+             !ShouldAllocateInHugePageRegion(owner, MemoryChunk::kPageSize)) {
+    chunk = AllocatePageFromPagePool(owner);
   }
   if (chunk == nullptr) {
     chunk = AllocateChunk(size, size, executable, owner);
@@ -588,17 +683,67 @@ MemoryAllocator::RemapSharedPage(
 LargePage* MemoryAllocator::AllocateLargePage(size_t size,
                                               LargeObjectSpace* owner,
                                               Executability executable) {
-  MemoryChunk* chunk = AllocateChunk(size, size, executable, owner);
+  MemoryChunk* chunk = nullptr;
+  if (executable == NOT_EXECUTABLE) {
+    chunk = AllocateLargePageFromCache(size, owner);
+  }
+  if (chunk == nullptr) {
+    chunk = AllocateChunk(size, size, executable, owner);
+  }
   if (chunk == nullptr) return nullptr;
   return LargePage::Initialize(isolate_->heap(), chunk, executable);
 }
 
+MemoryChunk* MemoryAllocator::AllocateLargePageFromCache(
+    size_t size, LargeObjectSpace* owner) {
+  const size_t chunk_size =
+      ::RoundUp(MemoryChunkLayout::ObjectStartOffsetInDataPage() + size,
+                GetCommitPageSize());
+  VirtualMemory reservation = large_page_cache_.TryGet(chunk_size);
+  if (!reservation.IsReserved()) return nullptr;
+  // Cached reservations are still committed. They may be larger than
+  // requested; the remainder is released when the page is shrunk to the
+  // object size after the next full GC.
+  const Address base = reservation.address();
+  const size_t reserved_size = reservation.size();
+  const Address area_start =
+      base + MemoryChunkLayout::ObjectStartOffsetInDataPage();
+  const Address area_end = area_start + size;
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(base, MemoryChunkLayout::ObjectStartOffsetInDataPage() + size,
+             kZapValue);
+  }
+  size_ += reserved_size;
+  LOG(isolate_,
+      NewEvent("MemoryChunk", reinterpret_cast<void*>(base), reserved_size));
+  BasicMemoryChunk* basic_chunk = BasicMemoryChunk::Initialize(
+      isolate_->heap(), base, reserved_size, area_start, area_end, owner,
+      std::move(reservation));
+  return MemoryChunk::Initialize(basic_chunk, isolate_->heap(), NOT_EXECUTABLE);
+}
+
 template <typename SpaceType>
 MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
   MemoryChunk* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
-  if (chunk == nullptr) return nullptr;
+  if (chunk == nullptr) return AllocatePageFromPagePool(owner);
+  return InitializePooledPage(reinterpret_cast<Address>(chunk), owner);
+}
+
+template <typename SpaceType>
+MemoryChunk* MemoryAllocator::AllocatePageFromPagePool(SpaceType* owner) {
+  PagePool* pool = PagePool::GetProcessWidePagePool();
+  if (!pool->CanPool(data_page_allocator())) return nullptr;
+  const Address start = pool->TryGet();
+  if (start == kNullAddress) return nullptr;
+  // The page may have been released by another heap.
+  UpdateAllocatedSpaceLimits(start, start + MemoryChunk::kPageSize);
+  return InitializePooledPage(start, owner);
+}
+
+template <typename SpaceType>
+MemoryChunk* MemoryAllocator::InitializePooledPage(Address start,
+                                                   SpaceType* owner) {
   const int size = MemoryChunk::kPageSize;
-  const Address start = reinterpret_cast<Address>(chunk);
   const Address area_start =
       start +
       MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(owner->identity());
@@ -613,9 +758,8 @@ MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
   BasicMemoryChunk* basic_chunk =
       BasicMemoryChunk::Initialize(isolate_->heap(), start, size, area_start,
                                    area_end, owner, std::move(reservation));
-  MemoryChunk::Initialize(basic_chunk, isolate_->heap(), NOT_EXECUTABLE);
   size_ += size;
-  return chunk;
+  return MemoryChunk::Initialize(basic_chunk, isolate_->heap(), NOT_EXECUTABLE);
 }
 
 void MemoryAllocator::ZapBlock(Address start, size_t size,
@@ -19,6 +19,7 @@
 #include "src/base/platform/semaphore.h"
 #include "src/heap/code-range.h"
 #include "src/heap/heap.h"
+#include "src/heap/large-page-cache.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/spaces.h"
 #include "src/tasks/cancelable-task.h"
@@ -50,7 +51,10 @@ class MemoryAllocator {
     }
 
     void AddMemoryChunkSafe(MemoryChunk* chunk) {
-      if (!chunk->IsLargePage() && chunk->executable() != EXECUTABLE) {
+      // Chunks from the huge page region cannot be stolen as they are owned by
+      // a different page allocator.
+      if (!chunk->IsLargePage() && chunk->executable() != EXECUTABLE &&
+          !allocator_->IsInHugePageRegion(chunk->address())) {
         AddMemoryChunkSafe<kRegular>(chunk);
       } else {
         AddMemoryChunkSafe<kNonRegular>(chunk);
@@ -215,7 +219,8 @@ class MemoryAllocator {
 
   Address AllocateAlignedMemory(size_t reserve_size, size_t commit_size,
                                 size_t alignment, Executability executable,
-                                void* hint, VirtualMemory* controller);
+                                v8::PageAllocator* page_allocator, void* hint,
+                                VirtualMemory* controller);
 
   void FreeMemory(v8::PageAllocator* page_allocator, Address addr, size_t size);
 
@@ -266,6 +271,26 @@ class MemoryAllocator {
 
   Unmapper* unmapper() { return &unmapper_; }
 
+  // Frees the reservations of large pages that are kept for reuse.
+  void ReleaseLargePageCache() { large_page_cache_.ReleaseAll(); }
+
+  // Returns whether |address| belongs to the huge page backed region that
+  // old space pages are allocated from when FLAG_huge_pages is enabled.
+  bool IsInHugePageRegion(Address address) const {
+    return huge_page_region_.contains(address);
+  }
+
+  // Returns whether |address| belongs to the huge page region and the OS
+  // accepted the advice to back that region with huge pages.
+  bool IsHugePageBacked(Address address) const {
+    return huge_pages_advised_ && IsInHugePageRegion(address);
+  }
+
+  const base::AddressRegion& huge_page_region() const {
+    return huge_page_region_;
+  }
+  bool huge_pages_advised() const { return huge_pages_advised_; }
+
   // Performs all necessary bookkeeping to free the memory, but does not free
   // it.
   void UnregisterMemory(MemoryChunk* chunk);
@@ -285,11 +310,37 @@ class MemoryAllocator {
   // before.
   void PerformFreeMemory(MemoryChunk* chunk);
 
+  // Uncommits a regular data page and hands it to the process-wide PagePool.
+  // Returns false if the page cannot be pooled and must be freed instead.
+  bool TryReturnToPagePool(MemoryChunk* chunk);
+
+  // Keeps the reservation of a freed large page in the LargePageCache.
+  // Returns false if the page cannot be cached and must be freed instead.
+  bool TryReturnToLargePageCache(MemoryChunk* chunk);
+
+  // Allocates a non-executable large page from the LargePageCache.
+  MemoryChunk* AllocateLargePageFromCache(size_t size, LargeObjectSpace* owner);
+
+  // Reserves the huge page backed region for old space pages.
+  void InitializeHugePageRegion();
+
+  // Returns whether a chunk of |chunk_size| for |owner| should be allocated
+  // from the huge page backed region.
+  bool ShouldAllocateInHugePageRegion(BaseSpace* owner, size_t chunk_size);
+
   // See AllocatePage for public interface. Note that currently we only
   // support pools for NOT_EXECUTABLE pages of size MemoryChunk::kPageSize.
   template <typename SpaceType>
   MemoryChunk* AllocatePagePooled(SpaceType* owner);
 
+  // Allocates a regular data page from the process-wide PagePool.
+  template <typename SpaceType>
+  MemoryChunk* AllocatePageFromPagePool(SpaceType* owner);
+
+  // Commits and initializes an uncommitted page of MemoryChunk::kPageSize.
+  template <typename SpaceType>
+  MemoryChunk* InitializePooledPage(Address start, SpaceType* owner);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -359,6 +410,18 @@ class MemoryAllocator {
   VirtualMemory last_chunk_;
   Unmapper unmapper_;
 
+  // Region that is backed by huge pages and used for old space pages when
+  // FLAG_huge_pages is enabled. The region is aligned to the huge page size,
+  // so every huge page holds a whole number of pages. Regular pages are
+  // allocated instead once the region is exhausted.
+  VirtualMemory huge_page_reservation_;
+  base::AddressRegion huge_page_region_;
+  std::unique_ptr<base::BoundedPageAllocator> huge_page_allocator_;
+  bool huge_pages_advised_ = false;
+
+  // Committed reservations of freed large pages.
+  LargePageCache large_page_cache_;
+
   // Data structure to remember allocated executable memory chunks.
   std::unordered_set<MemoryChunk*> executable_memory_;
   base::Mutex executable_memory_mutex_;
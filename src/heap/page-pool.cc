@@ -0,0 +1,76 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/page-pool.h"
+
+#include "src/base/lazy-instance.h"
+#include "src/flags/flags.h"
+#include "src/heap/memory-chunk.h"
+#include "src/utils/allocation.h"
+
+namespace v8 {
+namespace internal {
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(PagePool, PagePool::GetProcessWidePagePool)
+
+void PagePool::Initialize(v8::PageAllocator* page_allocator) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK(pages_.empty());
+  page_allocator_ = page_allocator;
+}
+
+bool PagePool::CanPool(v8::PageAllocator* page_allocator) const {
+  return FLAG_page_pool_size > 0 && page_allocator_ != nullptr &&
+         page_allocator_ == page_allocator;
+}
+
+size_t PagePool::MaxNumberOfPages() const {
+  return FLAG_page_pool_size * MB / MemoryChunk::kPageSize;
+}
+
+bool PagePool::Add(Address page) {
+  DCHECK_NOT_NULL(page_allocator_);
+  DCHECK(IsAligned(page, MemoryChunk::kAlignment));
+  base::MutexGuard guard(&mutex_);
+  // Check the capacity first, the caller frees the page if the pool is full.
+  if (pages_.size() >= MaxNumberOfPages()) return false;
+  if (FLAG_page_pool_decommit) {
+    // Pooled pages are uncommitted already, so this only affects how eagerly
+    // the OS reclaims the backing memory. The page must be decommitted before
+    // it is published as other heaps may pick it up right away.
+    USE(page_allocator_->DecommitPages(
+        reinterpret_cast<void*>(page),
+        static_cast<size_t>(MemoryChunk::kPageSize)));
+  }
+  pages_.push_back(page);
+  return true;
+}
+
+Address PagePool::TryGet() {
+  base::MutexGuard guard(&mutex_);
+  if (pages_.empty()) return kNullAddress;
+  Address page = pages_.back();
+  pages_.pop_back();
+  return page;
+}
+
+void PagePool::ReleaseAll() {
+  std::vector<Address> pages;
+  {
+    base::MutexGuard guard(&mutex_);
+    pages.swap(pages_);
+  }
+  for (Address page : pages) {
+    CHECK(FreePages(page_allocator_, reinterpret_cast<void*>(page),
+                    static_cast<size_t>(MemoryChunk::kPageSize)));
+  }
+}
+
+size_t PagePool::NumberOfPages() {
+  base::MutexGuard guard(&mutex_);
+  return pages_.size();
+}
+
+}  // namespace internal
+}  // namespace v8
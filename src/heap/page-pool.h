@@ -0,0 +1,70 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PAGE_POOL_H_
+#define V8_HEAP_PAGE_POOL_H_
+
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// The process-wide pool of uncommitted page reservations of size
+// MemoryChunk::kPageSize. Heaps return pages to the pool instead of unmapping
+// them and draw regular data pages from it instead of reserving fresh memory.
+// This avoids mmap/munmap churn in processes that frequently create and tear
+// down isolates.
+//
+// Pages can only be shared between heaps that allocate from the same page
+// allocator. The pool is thus only available if all heaps use a process-wide
+// page allocator, i.e., unless pointer compression uses per-isolate cages.
+class V8_EXPORT_PRIVATE PagePool final {
+ public:
+  static PagePool* GetProcessWidePagePool();
+
+  PagePool() = default;
+  PagePool(const PagePool&) = delete;
+  PagePool& operator=(const PagePool&) = delete;
+
+  // Sets the page allocator that all pooled pages are allocated from. Called
+  // once per process.
+  void Initialize(v8::PageAllocator* page_allocator);
+
+  // Returns whether pages allocated from |page_allocator| can be pooled.
+  bool CanPool(v8::PageAllocator* page_allocator) const;
+
+  // Adds the uncommitted page at |page| to the pool. Depending on
+  // FLAG_page_pool_decommit the physical memory of the page is released
+  // eagerly. Returns false if the pool is full in which case the caller keeps
+  // ownership of the page.
+  bool Add(Address page);
+
+  // Returns an uncommitted page from the pool or kNullAddress if the pool is
+  // empty.
+  Address TryGet();
+
+  // Frees all pages in the pool.
+  void ReleaseAll();
+
+  // Returns the number of pages in the pool.
+  size_t NumberOfPages();
+
+  v8::PageAllocator* page_allocator() const { return page_allocator_; }
+
+ private:
+  size_t MaxNumberOfPages() const;
+
+  v8::PageAllocator* page_allocator_ = nullptr;
+  base::Mutex mutex_;
+  std::vector<Address> pages_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PAGE_POOL_H_
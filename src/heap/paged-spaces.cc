@@ -878,7 +878,9 @@ bool PagedSpace::TryExpand(int size_in_bytes, AllocationOrigin origin) {
 bool PagedSpace::RawRefillLabMain(int size_in_bytes, AllocationOrigin origin) {
   // Allocation in this space has failed.
   DCHECK_GE(size_in_bytes, 0);
-  const int kMaxPagesToSweep = 1;
+  // Sweeping a few pages usually frees a large enough block. The main thread
+  // only sweeps all remaining pages when the space cannot be expanded.
+  const int kMaxPagesToSweep = 4;
 
   if (TryAllocationFromFreeListMain(size_in_bytes, origin)) return true;
 
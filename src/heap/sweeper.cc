@@ -25,7 +25,8 @@ Sweeper::Sweeper(Heap* heap, MajorNonAtomicMarkingState* marking_state)
       iterability_task_semaphore_(0),
       iterability_in_progress_(false),
       iterability_task_started_(false),
-      should_reduce_memory_(false) {}
+      should_reduce_memory_(false),
+      sweep_code_space_concurrently_(false) {}
 
 Sweeper::PauseOrCompleteScope::PauseOrCompleteScope(Sweeper* sweeper)
     : sweeper_(sweeper) {
@@ -111,8 +112,10 @@ class Sweeper::SweeperJob final : public JobTask {
       const AllocationSpace space_id = static_cast<AllocationSpace>(
           FIRST_GROWABLE_PAGED_SPACE +
           ((i + offset) % kNumberOfSweepingSpaces));
-      // Do not sweep code space concurrently.
-      if (space_id == CODE_SPACE) continue;
+      if (space_id == CODE_SPACE &&
+          !sweeper_->sweep_code_space_concurrently_) {
+        continue;
+      }
       DCHECK(IsValidSweepingSpace(space_id));
       if (!sweeper_->ConcurrentSweepSpace(space_id, delegate)) return;
     }
@@ -157,6 +160,11 @@ void Sweeper::StartSweeping() {
   sweeping_in_progress_ = true;
   iterability_in_progress_ = true;
   should_reduce_memory_ = heap_->ShouldReduceMemory();
+  // Background threads cannot flip the permissions of code pages as the
+  // mutator may execute code on them at the same time. Code space is thus only
+  // swept concurrently if code pages are writable and executable anyway.
+  sweep_code_space_concurrently_ = FLAG_concurrent_code_space_sweeping &&
+                                   !heap_->write_protect_code_memory();
   MajorNonAtomicMarkingState* marking_state =
       heap_->mark_compact_collector()->non_atomic_marking_state();
   ForAllSweepingSpaces([this, marking_state](AllocationSpace space) {
@@ -421,8 +429,17 @@ int Sweeper::RawSweep(
 
 size_t Sweeper::ConcurrentSweepingPageCount() {
   base::MutexGuard guard(&mutex_);
-  return sweeping_list_[GetSweepSpaceIndex(OLD_SPACE)].size() +
-         sweeping_list_[GetSweepSpaceIndex(MAP_SPACE)].size();
+  size_t count = sweeping_list_[GetSweepSpaceIndex(OLD_SPACE)].size() +
+                 sweeping_list_[GetSweepSpaceIndex(MAP_SPACE)].size();
+  if (sweep_code_space_concurrently_) {
+    count += sweeping_list_[GetSweepSpaceIndex(CODE_SPACE)].size();
+  }
+  return count;
+}
+
+bool Sweeper::IsSweepingListEmptySafe(AllocationSpace space) {
+  base::MutexGuard guard(&mutex_);
+  return sweeping_list_[GetSweepSpaceIndex(space)].empty();
 }
 
 bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
@@ -430,10 +447,12 @@ bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
   while (!delegate->ShouldYield()) {
     Page* page = GetSweepingPageSafe(identity);
     if (page == nullptr) return true;
-    // Typed slot sets are only recorded on code pages. Code pages
-    // are not swept concurrently to the application to ensure W^X.
-    DCHECK(!page->typed_slot_set<OLD_TO_NEW>() &&
-           !page->typed_slot_set<OLD_TO_OLD>());
+    // Typed slot sets are only recorded on code pages. Code pages are only
+    // swept concurrently to the application if they are not write protected.
+    // The page lock synchronizes with the generational barrier for code.
+    DCHECK_IMPLIES(page->typed_slot_set<OLD_TO_NEW>() ||
+                       page->typed_slot_set<OLD_TO_OLD>(),
+                   identity == CODE_SPACE && sweep_code_space_concurrently_);
     ParallelSweepPage(page, identity);
   }
   return false;
@@ -81,6 +81,9 @@ class Sweeper {
   Sweeper(Heap* heap, MajorNonAtomicMarkingState* marking_state);
 
   bool sweeping_in_progress() const { return sweeping_in_progress_; }
+  bool sweep_code_space_concurrently() const {
+    return sweep_code_space_concurrently_;
+  }
 
   void TearDown();
 
@@ -97,6 +100,10 @@ class Sweeper {
 
   void EnsurePageIsSwept(Page* page);
 
+  // Returns whether all pages of |space| have been taken for sweeping. Pages
+  // may still be in the process of being swept by concurrent sweeper tasks.
+  bool IsSweepingListEmptySafe(AllocationSpace space);
+
   void ScheduleIncrementalSweepingTask();
 
   int RawSweep(
@@ -226,6 +233,7 @@ class Sweeper {
   bool iterability_in_progress_;
   bool iterability_task_started_;
   bool should_reduce_memory_;
+  bool sweep_code_space_concurrently_;
 };
 
 }  // namespace internal
@@ -99,6 +99,9 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
     int secondary_offset = SecondaryOffset(
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key)), seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (!secondary->map.IsSmi()) {
+      isolate()->counters()->megamorphic_stub_cache_evictions()->Increment();
+    }
     *secondary = *primary;
   }
 
@@ -8,6 +8,14 @@
 #include "src/objects/name.h"
 #include "src/objects/tagged-value.h"
 
+#ifndef V8_STUB_CACHE_PRIMARY_TABLE_BITS
+#define V8_STUB_CACHE_PRIMARY_TABLE_BITS 11
+#endif
+
+#ifndef V8_STUB_CACHE_SECONDARY_TABLE_BITS
+#define V8_STUB_CACHE_SECONDARY_TABLE_BITS 9
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -85,10 +93,16 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
+  // The table sizes are baked into the stub cache probing code of the
+  // builtins, so they can only be changed at build time (see the
+  // v8_stub_cache_{primary,secondary}_table_bits gn args).
+  static const int kPrimaryTableBits = V8_STUB_CACHE_PRIMARY_TABLE_BITS;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
+  static const int kSecondaryTableBits = V8_STUB_CACHE_SECONDARY_TABLE_BITS;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The scaled offsets have to fit into 32 bits.
+  STATIC_ASSERT(kPrimaryTableBits + kCacheIndexShift < 32);
+  STATIC_ASSERT(kSecondaryTableBits + kCacheIndexShift < 32);
 
   // We compute the hash code for a map as follows:
   //   <code> = <address> ^ (<address> >> kMapKeyShift)
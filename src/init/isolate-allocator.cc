@@ -8,6 +8,7 @@
 #include "src/common/ptr-compr.h"
 #include "src/execution/isolate.h"
 #include "src/heap/code-range.h"
+#include "src/heap/page-pool.h"
 #include "src/init/vm-cage.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
@@ -67,6 +68,7 @@ void IsolateAllocator::FreeProcessWidePtrComprCageForTesting() {
           CodeRange::GetProcessWideCodeRange()) {
     code_range->Free();
   }
+  PagePool::GetProcessWidePagePool()->ReleaseAll();
   GetProcessWidePtrComprCage()->Free();
 }
 #endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
@@ -102,6 +104,10 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  PagePool::GetProcessWidePagePool()->Initialize(
+      GetProcessWidePtrComprCage()->page_allocator());
+#elif !defined(V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE)
+  PagePool::GetProcessWidePagePool()->Initialize(GetPlatformPageAllocator());
 #endif
 }
 
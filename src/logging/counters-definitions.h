@@ -11,6 +11,8 @@ namespace internal {
 #define HISTOGRAM_RANGE_LIST(HR)                                               \
   /* Generic range histograms: HR(name, caption, min, max, num_buckets) */     \
   HR(background_marking, V8.GCBackgroundMarking, 0, 10000, 101)                \
+  HR(background_minor_mc_marking, V8.GCBackgroundMinorMCMarking, 0, 10000,    \
+     101)                                                                      \
   HR(background_scavenger, V8.GCBackgroundScavenger, 0, 10000, 101)            \
   HR(background_sweeping, V8.GCBackgroundSweeping, 0, 10000, 101)              \
   HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 6, 6)              \
@@ -28,6 +30,10 @@ namespace internal {
   HR(gc_finalize_sweep, V8.GCFinalizeMC.Sweep, 0, 10000, 101)                  \
   HR(gc_scavenger_scavenge_main, V8.GCScavenger.ScavengeMain, 0, 10000, 101)   \
   HR(gc_scavenger_scavenge_roots, V8.GCScavenger.ScavengeRoots, 0, 10000, 101) \
+  HR(gc_minor_mc_evacuate, V8.GCMinorMC.Evacuate, 0, 10000, 101)               \
+  HR(gc_minor_mc_mark, V8.GCMinorMC.Mark, 0, 10000, 101)                       \
+  HR(gc_minor_mc_mark_main, V8.GCMinorMC.MarkMain, 0, 10000, 101)              \
+  HR(gc_minor_mc_mark_seed, V8.GCMinorMC.MarkSeed, 0, 10000, 101)              \
   HR(gc_mark_compactor, V8.GCMarkCompactor, 0, 10000, 101)                     \
   HR(gc_marking_sum, V8.GCMarkingSum, 0, 10000, 101)                           \
   /* Range and bucket matches BlinkGC.MainThreadMarkingThroughput. */          \
@@ -151,6 +157,7 @@ namespace internal {
      V8.GCFinalizeMCReduceMemoryBackground, 10000, MILLISECOND)                \
   HT(gc_finalize_reduce_memory_foreground,                                     \
      V8.GCFinalizeMCReduceMemoryForeground, 10000, MILLISECOND)                \
+  HT(gc_minor_mc, V8.GCMinorMC, 10000, MILLISECOND)                            \
   HT(gc_scavenger, V8.GCScavenger, 10000, MILLISECOND)                         \
   HT(gc_scavenger_background, V8.GCScavengerBackground, 10000, MILLISECOND)    \
   HT(gc_scavenger_foreground, V8.GCScavengerForeground, 10000, MILLISECOND)    \
@@ -313,6 +320,7 @@ namespace internal {
   SC(cow_arrays_converted, V8.COWArraysConverted)                              \
   SC(constructed_objects_runtime, V8.ConstructedObjectsRuntime)                \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_evictions, V8.MegamorphicStubCacheEvictions)       \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(string_add_runtime, V8.StringAddRuntime)                                  \
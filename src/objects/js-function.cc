@@ -6,6 +6,7 @@
 
 #include "src/codegen/compiler.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/execution/optimization-profile.h"
 #include "src/heap/heap-inl.h"
 #include "src/ic/ic.h"
 #include "src/init/bootstrapper.h"
@@ -313,6 +314,14 @@ void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function,
   Handle<SharedFunctionInfo> shared(function->shared(), isolate);
   DCHECK(function->shared().HasBytecodeArray());
 
+  // Functions that reached the top tier in the run that produced the profile
+  // are tiered up early, just like functions deserialized with that hint.
+  if (V8_UNLIKELY(isolate->optimization_profile() != nullptr) &&
+      !shared->was_optimized() &&
+      isolate->optimization_profile()->Contains(*shared)) {
+    shared->set_was_optimized(true);
+  }
+
   EnsureClosureFeedbackCellArray(function, false);
   Handle<ClosureFeedbackCellArray> closure_feedback_cell_array =
       handle(function->closure_feedback_cell_array(), isolate);
@@ -474,6 +474,11 @@ class SharedFunctionInfo
   // closest outer class scope.
   DECL_BOOLEAN_ACCESSORS(private_name_lookup_skips_outer_class)
 
+  // Indicates that top-tier optimized code was installed for a closure of
+  // this function. The bit is serialized into the code cache, so that a
+  // process consuming the cache can tier up such functions early.
+  DECL_BOOLEAN_ACCESSORS(was_optimized)
+
   inline FunctionKind kind() const;
 
   // Defines the index in a native context of closure's map instantiated using
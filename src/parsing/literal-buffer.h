@@ -38,6 +38,21 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Appends a run of ASCII code units taken directly from a UTF-16 buffer.
+  V8_INLINE void AddAsciiChars(const uint16_t* chars, int length) {
+    if (!is_one_byte()) {
+      for (int i = 0; i < length; i++) AddTwoByteChar(chars[i]);
+      return;
+    }
+    while (position_ + length > backing_store_.length()) ExpandBuffer();
+    byte* dst = backing_store_.begin() + position_;
+    for (int i = 0; i < length; i++) {
+      DCHECK_LE(chars[i], unibrow::Utf8::kMaxOneByteChar);
+      dst[i] = static_cast<byte>(chars[i]);
+    }
+    position_ += length;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
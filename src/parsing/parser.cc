@@ -2592,9 +2592,14 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   // If parallel compile tasks are enabled, and the function is an eager
   // top level function, then we can pre-parse the function and parse / compile
-  // in a parallel task on a worker thread.
+  // in a parallel task on a worker thread. With
+  // --parallel-compile-tasks-for-lazy, lazy top level functions are handed to
+  // the worker threads as well, so that a large script's functions are fully
+  // parsed and compiled off the main thread before their first call.
   bool should_post_parallel_task =
-      parse_lazily() && is_eager_top_level_function &&
+      parse_lazily() &&
+      (is_eager_top_level_function ||
+       (FLAG_parallel_compile_tasks_for_lazy && is_lazy_top_level_function)) &&
       FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
@@ -9,6 +9,7 @@
 
 #include "include/v8-callbacks.h"
 #include "include/v8-primitive.h"
+#include "src/base/bounds.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/handles/handles.h"
@@ -622,6 +623,15 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
     if (t != unibrow::Utf8::kIncomplete) {
       chars++;
       if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) chars++;
+      // Fast path for ascii sequences.
+      if (chars < position) {
+        DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
+        size_t max_length =
+            std::min(static_cast<size_t>(end - cursor), position - chars);
+        int ascii_length = NonAsciiStart(cursor, static_cast<int>(max_length));
+        cursor += ascii_length;
+        chars += ascii_length;
+      }
     }
   }
 
@@ -712,6 +722,16 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     CopyChars(output_cursor, cursor, ascii_length);
     cursor += ascii_length;
     output_cursor += ascii_length;
+    // Fast path for two-byte sequences (U+0080..U+07FF, which covers Latin-1).
+    // Lead bytes 0xC2..0xDF followed by a continuation byte are always valid,
+    // so they can be decoded without the incremental decoder.
+    while (end - cursor >= 2 && output_cursor < max_buffer_end &&
+           base::IsInRange(cursor[0], uint8_t{0xC2}, uint8_t{0xDF}) &&
+           base::IsInRange(cursor[1], uint8_t{0x80}, uint8_t{0xBF})) {
+      *(output_cursor++) = static_cast<base::uc16>(((cursor[0] & 0x1F) << 6) |
+                                                   (cursor[1] & 0x3F));
+      cursor += 2;
+    }
   }
 
   current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data);
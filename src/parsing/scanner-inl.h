@@ -6,6 +6,7 @@
 #define V8_PARSING_SCANNER_INL_H_
 
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-search.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
@@ -273,31 +274,34 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
+      AdvanceUntilFound([this](const uint16_t* start, const uint16_t* end) {
+        const uint16_t* run_end =
+            scanner_search::FindNonAsciiIdentifierPart(start, end);
+        AddLiteralAsciiChars(start, run_end);
+        return run_end;
       });
 
+      base::Vector<const uint8_t> chars =
+          next().literal_chars.one_byte_literal();
+      if (chars.length() > MAX_WORD_LENGTH) {
+        // Too long to be a keyword, no need to look at the characters.
+        scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+      } else {
+        for (int i = 1; i < chars.length(); i++) {
+          scan_flags |= character_scan_flags[chars[i]];
+        }
+      }
+      // An escape or a non-ascii character means we need to drop through to
+      // the slow path.
+      if (V8_UNLIKELY(c0_ == '\\' ||
+                      (static_cast<uint32_t>(c0_) > kMaxAscii &&
+                       c0_ != kEndOfInput))) {
+        scan_flags |= static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+      }
+
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::IDENTIFIER;
         // Could be a keyword or identifier.
-        base::Vector<const uint8_t> chars =
-            next().literal_chars.one_byte_literal();
         return KeywordOrIdentifierToken(chars.begin(), chars.length());
       }
 
@@ -329,7 +333,8 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
-    Advance();
+    // Skip runs of spaces and tabs (e.g. indentation) in one go.
+    AdvanceUntilFound(scanner_search::FindNonBlank);
   }
 
   // Return whether or not we skipped any characters.
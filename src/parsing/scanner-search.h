@@ -0,0 +1,174 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Vectorized searches over the UTF-16 buffer of a Utf16CharacterStream, used
+// by the scanner to skip over runs of characters that need no per-character
+// processing (comment bodies, blanks, identifier parts and plain string
+// contents).
+
+#ifndef V8_PARSING_SCANNER_SEARCH_H_
+#define V8_PARSING_SCANNER_SEARCH_H_
+
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/macros.h"
+
+// Like swiss-hash-table-helpers.h, only use SSE2 if both the host compiler and
+// the target support it. Other configurations use the scalar loops below.
+#ifndef V8_SCANNER_SEARCH_HAVE_SSE2
+#if (defined(__SSE2__) ||                                             \
+     (defined(_MSC_VER) &&                                            \
+      (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2)))) && \
+    (defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64))
+#define V8_SCANNER_SEARCH_HAVE_SSE2 1
+#else
+#define V8_SCANNER_SEARCH_HAVE_SSE2 0
+#endif
+#endif
+
+#if V8_SCANNER_SEARCH_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace v8 {
+namespace internal {
+namespace scanner_search {
+
+// Scalar predicates. Each search below returns a pointer to the first code
+// unit in [start, end) for which the corresponding predicate holds, or |end|
+// if there is none.
+V8_INLINE bool IsLineTerminator(uint16_t c) {
+  return c == '\n' || c == '\r' || (c & 0xFFFE) == 0x2028;
+}
+V8_INLINE bool IsNotBlank(uint16_t c) { return c != ' ' && c != '\t'; }
+V8_INLINE bool IsNotAsciiIdentifierPart(uint16_t c) {
+  uint16_t lower = c | 0x20;
+  return !((lower >= 'a' && lower <= 'z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == '$');
+}
+V8_INLINE bool MayEndPlainStringRun(uint16_t c) {
+  return c > 0x7F || c == '\'' || c == '"' || c == '\\' || c == '\n' ||
+         c == '\r';
+}
+
+#if V8_SCANNER_SEARCH_HAVE_SSE2
+constexpr int kLanes = sizeof(__m128i) / sizeof(uint16_t);
+
+V8_INLINE __m128i Splat(uint16_t c) {
+  return _mm_set1_epi16(static_cast<int16_t>(c));
+}
+
+// Lane-wise lo <= c <= hi. Code units >= 0x8000 compare as negative and never
+// fall into an ASCII range.
+V8_INLINE __m128i InRange(__m128i chars, uint16_t lo, uint16_t hi) {
+  __m128i above_lo =
+      _mm_cmpgt_epi16(chars, Splat(static_cast<uint16_t>(lo - 1)));
+  __m128i below_hi =
+      _mm_cmplt_epi16(chars, Splat(static_cast<uint16_t>(hi + 1)));
+  return _mm_and_si128(above_lo, below_hi);
+}
+
+// Scans whole 128-bit chunks. |matches| returns all-ones lanes for code units
+// that satisfy the predicate; if |invert| is set it returns the lanes that do
+// not. Stops at the first chunk containing a match, and leaves any tail
+// shorter than a chunk to the caller.
+template <bool invert, typename VectorPredicate>
+V8_INLINE const uint16_t* FindInChunks(const uint16_t* cursor,
+                                       const uint16_t* end,
+                                       VectorPredicate matches) {
+  while (end - cursor >= kLanes) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches(chunk)));
+    if (invert) mask ^= 0xFFFF;
+    if (mask != 0) {
+      // Each 16-bit lane contributes two bits to the byte mask.
+      return cursor + (base::bits::CountTrailingZeros(mask) >> 1);
+    }
+    cursor += kLanes;
+  }
+  return cursor;
+}
+#endif  // V8_SCANNER_SEARCH_HAVE_SSE2
+
+template <typename ScalarPredicate>
+V8_INLINE const uint16_t* FindInTail(const uint16_t* cursor,
+                                     const uint16_t* end,
+                                     ScalarPredicate matches) {
+  while (cursor < end && !matches(*cursor)) ++cursor;
+  return cursor;
+}
+
+V8_INLINE const uint16_t* FindLineTerminator(const uint16_t* start,
+                                             const uint16_t* end) {
+#if V8_SCANNER_SEARCH_HAVE_SSE2
+  start = FindInChunks<false>(start, end, [](__m128i c) {
+    __m128i nl = _mm_or_si128(_mm_cmpeq_epi16(c, Splat('\n')),
+                              _mm_cmpeq_epi16(c, Splat('\r')));
+    __m128i ls_ps =
+        _mm_cmpeq_epi16(_mm_and_si128(c, Splat(0xFFFE)), Splat(0x2028));
+    return _mm_or_si128(nl, ls_ps);
+  });
+#endif
+  return FindInTail(start, end, IsLineTerminator);
+}
+
+V8_INLINE const uint16_t* FindChar(const uint16_t* start, const uint16_t* end,
+                                   uint16_t needle) {
+#if V8_SCANNER_SEARCH_HAVE_SSE2
+  __m128i splat = Splat(needle);
+  start = FindInChunks<false>(
+      start, end, [splat](__m128i c) { return _mm_cmpeq_epi16(c, splat); });
+#endif
+  return FindInTail(start, end, [needle](uint16_t c) { return c == needle; });
+}
+
+V8_INLINE const uint16_t* FindNonBlank(const uint16_t* start,
+                                       const uint16_t* end) {
+#if V8_SCANNER_SEARCH_HAVE_SSE2
+  start = FindInChunks<true>(start, end, [](__m128i c) {
+    return _mm_or_si128(_mm_cmpeq_epi16(c, Splat(' ')),
+                        _mm_cmpeq_epi16(c, Splat('\t')));
+  });
+#endif
+  return FindInTail(start, end, IsNotBlank);
+}
+
+V8_INLINE const uint16_t* FindNonAsciiIdentifierPart(const uint16_t* start,
+                                                     const uint16_t* end) {
+#if V8_SCANNER_SEARCH_HAVE_SSE2
+  start = FindInChunks<true>(start, end, [](__m128i c) {
+    __m128i alpha = InRange(_mm_or_si128(c, Splat(0x20)), 'a', 'z');
+    __m128i digit = InRange(c, '0', '9');
+    __m128i other = _mm_or_si128(_mm_cmpeq_epi16(c, Splat('_')),
+                                 _mm_cmpeq_epi16(c, Splat('$')));
+    return _mm_or_si128(_mm_or_si128(alpha, digit), other);
+  });
+#endif
+  return FindInTail(start, end, IsNotAsciiIdentifierPart);
+}
+
+V8_INLINE const uint16_t* FindPlainStringRunEnd(const uint16_t* start,
+                                                const uint16_t* end) {
+#if V8_SCANNER_SEARCH_HAVE_SSE2
+  start = FindInChunks<true>(start, end, [](__m128i c) {
+    __m128i ascii =
+        _mm_cmpeq_epi16(_mm_and_si128(c, Splat(0xFF80)), _mm_setzero_si128());
+    __m128i special = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(c, Splat('\'')),
+                     _mm_cmpeq_epi16(c, Splat('"'))),
+        _mm_or_si128(_mm_cmpeq_epi16(c, Splat('\\')),
+                     _mm_or_si128(_mm_cmpeq_epi16(c, Splat('\n')),
+                                  _mm_cmpeq_epi16(c, Splat('\r')))));
+    return _mm_andnot_si128(special, ascii);
+  });
+#endif
+  return FindInTail(start, end, MayEndPlainStringRun);
+}
+
+}  // namespace scanner_search
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SEARCH_H_
@@ -211,7 +211,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  AdvanceUntilFound(scanner_search::FindLineTerminator);
 
   return Token::WHITESPACE;
 }
@@ -303,7 +303,9 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilFound([](const uint16_t* start, const uint16_t* end) {
+      return scanner_search::FindChar(start, end, '*');
+    });
 
     while (c0_ == '*') {
       Advance();
@@ -457,18 +459,16 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
+    AdvanceUntilFound([this](const uint16_t* start, const uint16_t* end) {
+      while (true) {
+        const uint16_t* run_end =
+            scanner_search::FindPlainStringRunEnd(start, end);
+        AddLiteralAsciiChars(start, run_end);
+        // Non-ascii characters never terminate a string literal.
+        if (run_end == end || *run_end <= kMaxAscii) return run_end;
+        AddLiteralChar(static_cast<base::uc32>(*run_end));
+        start = run_end + 1;
       }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
     });
 
     while (c0_ == '\\') {
@@ -74,12 +74,23 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE base::uc32 AdvanceUntil(FunctionType check) {
-    while (true) {
-      auto next_cursor_pos =
-          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
+    return AdvanceUntilFound(
+        [&check](const uint16_t* start, const uint16_t* end) {
+          return std::find_if(start, end, [&check](uint16_t raw_c0_) {
             base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
             return check(c0_);
           });
+        });
+  }
+
+  // Like AdvanceUntil, but |find| searches a whole buffered block at a time:
+  // it is called with the remaining [start, end) of the buffer and returns the
+  // first matching position, or |end| if there is none. This lets callers use
+  // the vectorized searches from scanner-search.h.
+  template <typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntilFound(FunctionType find) {
+    while (true) {
+      const uint16_t* next_cursor_pos = find(buffer_cursor_, buffer_end_);
 
       if (next_cursor_pos == buffer_end_) {
         buffer_cursor_ = buffer_end_;
@@ -509,6 +520,11 @@ class V8_EXPORT_PRIVATE Scanner {
 
   V8_INLINE void AddLiteralChar(char c) { next().literal_chars.AddChar(c); }
 
+  V8_INLINE void AddLiteralAsciiChars(const uint16_t* start,
+                                      const uint16_t* end) {
+    next().literal_chars.AddAsciiChars(start, static_cast<int>(end - start));
+  }
+
   V8_INLINE void AddRawLiteralChar(base::uc32 c) {
     next().raw_literal_chars.AddChar(c);
   }
@@ -532,6 +548,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntilFound(FunctionType find) {
+    c0_ = source_->AdvanceUntilFound(find);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -2232,30 +2232,35 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   heap_->CollectAllAvailableGarbage(GarbageCollectionReason::kHeapProfiler);
 
-  NullContextForSnapshotScope null_context_scope(isolate);
-  SafepointScope scope(heap_);
-  v8_heap_explorer_.MakeGlobalObjectTagMap(scope);
-  handle_scope.reset();
+  {
+    // Only walking the heap requires background threads to be stopped.
+    NullContextForSnapshotScope null_context_scope(isolate);
+    SafepointScope scope(heap_);
+    v8_heap_explorer_.MakeGlobalObjectTagMap(scope);
+    handle_scope.reset();
 
 #ifdef VERIFY_HEAP
-  Heap* debug_heap = heap_;
-  if (FLAG_verify_heap) {
-    debug_heap->Verify();
-  }
+    Heap* debug_heap = heap_;
+    if (FLAG_verify_heap) {
+      debug_heap->Verify();
+    }
 #endif
 
-  InitProgressCounter();
+    InitProgressCounter();
 
 #ifdef VERIFY_HEAP
-  if (FLAG_verify_heap) {
-    debug_heap->Verify();
-  }
+    if (FLAG_verify_heap) {
+      debug_heap->Verify();
+    }
 #endif
 
-  snapshot_->AddSyntheticRootEntries();
+    snapshot_->AddSyntheticRootEntries();
 
-  if (!FillReferences()) return false;
+    if (!FillReferences()) return false;
+  }
 
+  // The remaining steps only operate on the snapshot, background threads can
+  // resume in the meantime.
   snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
@@ -6,6 +6,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/numbers/double.h"
 #include "src/base/platform/mutex.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
@@ -684,6 +685,14 @@ RUNTIME_FUNCTION(Runtime_FinalizeOptimization) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_WaitForBaselineCompilation) {
+  DCHECK_EQ(0, args.length());
+  if (FLAG_concurrent_sparkplug) {
+    isolate->baseline_batch_compiler()->AwaitCompileTasks();
+  }
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 static void ReturnNull(const v8::FunctionCallbackInfo<v8::Value>& args) {
   args.GetReturnValue().SetNull();
 }
@@ -234,6 +234,18 @@ bool SetPermissions(v8::PageAllocator* page_allocator, void* address,
   return page_allocator->SetPermissions(address, size, access);
 }
 
+base::AddressRegion AdviseHugePages(base::AddressRegion region) {
+  const size_t huge_page_size = base::OS::HugePageSize();
+  if (huge_page_size == 0) return base::AddressRegion();
+  const Address start = RoundUp(region.begin(), huge_page_size);
+  const Address end = RoundDown(region.end(), huge_page_size);
+  if (end <= start) return base::AddressRegion();
+  if (!base::OS::AdviseHugePages(reinterpret_cast<void*>(start), end - start)) {
+    return base::AddressRegion();
+  }
+  return base::AddressRegion(start, end - start);
+}
+
 bool OnCriticalMemoryPressure(size_t length) {
   // TODO(bbudge) Rework retry logic once embedders implement the more
   // informative overload.
@@ -167,6 +167,12 @@ inline bool SetPermissions(v8::PageAllocator* page_allocator, Address address,
                         access);
 }
 
+// Requests huge pages for the largest part of |region| that is aligned to the
+// OS huge page size. Returns that part, or an empty region if huge pages are
+// not available.
+V8_EXPORT_PRIVATE base::AddressRegion AdviseHugePages(
+    base::AddressRegion region);
+
 // Function that may release reserved memory regions to allow failed allocations
 // to succeed. |length| is the amount of memory needed. Returns |true| if memory
 // could be released, false otherwise.
@@ -50,6 +50,10 @@ class InstructionSchedulerTester {
              successors.end());
   }
 
+  int GetInstructionLatency(Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
+
   Zone* zone() { return scope_.main_zone(); }
 
  private:
@@ -107,6 +111,61 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+#if V8_TARGET_ARCH_X64
+TEST(X64InstructionLatencies) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  InstructionOperand outputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0)};
+  InstructionOperand inputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1),
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 2)};
+  auto with_output = [&](InstructionCode opcode) {
+    return Instruction::New(zone, opcode, arraysize(outputs), outputs,
+                            arraysize(inputs), inputs, 0, nullptr);
+  };
+  auto without_output = [&](InstructionCode opcode) {
+    return Instruction::New(zone, opcode, 0, nullptr, arraysize(inputs),
+                            inputs, 0, nullptr);
+  };
+  InstructionCode memory_operand = AddressingModeField::encode(kMode_MR);
+
+  // ALU operations wait for their memory operand to be loaded.
+  CHECK_EQ(1, tester.GetInstructionLatency(with_output(kX64Add)));
+  CHECK_EQ(5, tester.GetInstructionLatency(
+                  with_output(kX64Add | memory_operand)));
+  CHECK_EQ(1, tester.GetInstructionLatency(without_output(kX64Cmp32)));
+  CHECK_EQ(5, tester.GetInstructionLatency(
+                  without_output(kX64Cmp32 | memory_operand)));
+
+  // Loads take the load-to-use latency, stores and moves between registers
+  // do not.
+  CHECK_EQ(4, tester.GetInstructionLatency(
+                  with_output(kX64Movq | memory_operand)));
+  CHECK_EQ(1, tester.GetInstructionLatency(with_output(kX64Movq)));
+  CHECK_EQ(1, tester.GetInstructionLatency(
+                  without_output(kX64Movq | memory_operand)));
+  CHECK_EQ(5, tester.GetInstructionLatency(
+                  with_output(kX64Movsd | memory_operand)));
+
+  // The SSE and AVX forms of the float operations have the same latencies.
+  CHECK_EQ(5, tester.GetInstructionLatency(with_output(kSSEFloat64Mul)));
+  CHECK_EQ(5, tester.GetInstructionLatency(with_output(kAVXFloat64Mul)));
+  CHECK_EQ(4, tester.GetInstructionLatency(with_output(kSSEFloat32Mul)));
+  CHECK_EQ(4, tester.GetInstructionLatency(with_output(kAVXFloat32Mul)));
+  CHECK_EQ(3, tester.GetInstructionLatency(with_output(kAVXFloat64Add)));
+  CHECK_EQ(13, tester.GetInstructionLatency(with_output(kAVXFloat64Div)));
+
+  // Conversions.
+  CHECK_EQ(4, tester.GetInstructionLatency(with_output(kSSEFloat64ToInt32)));
+  CHECK_EQ(4, tester.GetInstructionLatency(with_output(kSSEFloat32ToFloat64)));
+  CHECK_EQ(10, tester.GetInstructionLatency(with_output(kSSEFloat64ToInt64)));
+  CHECK_EQ(6,
+           tester.GetInstructionLatency(with_output(kArchTruncateDoubleToI)));
+}
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -13,6 +13,7 @@
 #define HEAP_TEST_METHODS(V)                                \
   V(CodeLargeObjectSpace)                                   \
   V(CodeLargeObjectSpace64k)                                \
+  V(CompactionBoundedByPauseBudget)                         \
   V(CompactionFullAbortedPage)                              \
   V(CompactionPartiallyAbortedPage)                         \
   V(CompactionPartiallyAbortedPageIntraAbortedPointers)     \
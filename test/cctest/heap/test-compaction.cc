@@ -4,6 +4,8 @@
 
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/heap/gc-pause-budget.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/memory-chunk.h"
@@ -491,6 +493,105 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+namespace {
+
+// Fills |number_of_pages| fresh old space pages with small arrays of which
+// only every tenth is kept alive by the returned array.
+Handle<FixedArray> FragmentOldSpace(Isolate* isolate, int number_of_pages) {
+  const int kObjectsPerPage = 100;
+  const int kSurvivorRatio = 10;
+  Heap* heap = isolate->heap();
+  Handle<FixedArray> survivors = isolate->factory()->NewFixedArray(
+      number_of_pages * (kObjectsPerPage / kSurvivorRatio + 1),
+      AllocationType::kOld);
+  heap::SealCurrentObjects(heap);
+  int survivor_index = 0;
+  for (int i = 0; i < number_of_pages; i++) {
+    HandleScope scope(isolate);
+    CHECK(heap->old_space()->Expand());
+    std::vector<Handle<FixedArray>> handles = heap::CreatePadding(
+        heap,
+        static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+        AllocationType::kOld, GetObjectSize(kObjectsPerPage));
+    for (size_t j = 0; j < handles.size(); j += kSurvivorRatio) {
+      survivors->set(survivor_index++, *handles[j]);
+    }
+  }
+  return survivors;
+}
+
+// Selects evacuation candidates and returns the number of old space pages
+// that were selected along with their live bytes.
+int SelectOldSpaceEvacuationCandidates(Heap* heap, size_t* live_bytes) {
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  collector->StartCompaction();
+  int candidates = 0;
+  *live_bytes = 0;
+  for (Page* page : *heap->old_space()) {
+    if (!page->IsEvacuationCandidate()) continue;
+    candidates++;
+    *live_bytes += page->allocated_bytes();
+  }
+  collector->AbortCompaction();
+  return candidates;
+}
+
+}  // namespace
+
+HEAP_TEST(CompactionBoundedByPauseBudget) {
+  if (FLAG_never_compact || FLAG_manual_evacuation_candidates_selection ||
+      FLAG_stress_compaction || FLAG_stress_compaction_random ||
+      FLAG_always_compact || FLAG_gc_experiment_less_compaction) {
+    return;
+  }
+  // Test that the live bytes on evacuation candidates are bounded by the GC
+  // pause budget, unless the GC is reducing memory.
+  ManualGCScope manual_gc_scope;
+  const int kFragmentedPages = 64;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.constraints.set_max_gc_pause_time_in_ms(1);
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    HandleScope scope(i_isolate);
+    Heap* heap = i_isolate->heap();
+    CHECK(heap->gc_pause_budget()->IsEnabled());
+
+    Handle<FixedArray> survivors =
+        FragmentOldSpace(i_isolate, kFragmentedPages);
+    CcTest::CollectAllGarbage(i_isolate);
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+    USE(survivors);
+
+    const size_t area_size = heap->old_space()->AreaSize();
+    const size_t budget_bytes = std::max(
+        area_size,
+        GCPauseBudget::EstimateMaxEvacuatedBytes(
+            heap->gc_pause_budget()->budget_in_ms(),
+            heap->tracer()->CompactionSpeedInBytesPerMillisecond()));
+
+    size_t live_bytes = 0;
+    int candidates = SelectOldSpaceEvacuationCandidates(heap, &live_bytes);
+    CHECK_LT(0, candidates);
+    CHECK_LE(live_bytes, budget_bytes);
+
+    // Memory-reducing GCs are not bounded by the budget and select all of the
+    // fragmented pages.
+    heap->set_current_gc_flags(Heap::kReduceMemoryFootprintMask);
+    size_t reduce_memory_live_bytes = 0;
+    int reduce_memory_candidates =
+        SelectOldSpaceEvacuationCandidates(heap, &reduce_memory_live_bytes);
+    heap->set_current_gc_flags(Heap::kNoGCFlags);
+    CHECK_LE(kFragmentedPages - 1, reduce_memory_candidates);
+    CHECK_LE(candidates, reduce_memory_candidates);
+    CHECK_LE(live_bytes, reduce_memory_live_bytes);
+  }
+  isolate->Dispose();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -31,6 +31,7 @@
 
 #include "include/v8-function.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
 #include "src/base/strings.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
@@ -7381,6 +7382,126 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+UNINITIALIZED_TEST(ConcurrentCodeSpaceSweeping) {
+  if (!FLAG_concurrent_sweeping) return;
+  FLAG_write_protect_code_memory = false;
+  FLAG_concurrent_code_space_sweeping = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Heap* heap = i_isolate->heap();
+  {
+    HandleScope scope(i_isolate);
+    Assembler assm(AssemblerOptions{});
+    assm.nop();
+    CodeDesc desc;
+    assm.GetCode(i_isolate, &desc);
+
+    // Keep every other code object alive, so that code pages have to be
+    // swept and cannot just be released.
+    const int kNumberOfCodeObjects = 4000;
+    Handle<FixedArray> survivors =
+        i_isolate->factory()->NewFixedArray(kNumberOfCodeObjects / 2);
+    for (int i = 0; i < kNumberOfCodeObjects; i++) {
+      HandleScope inner_scope(i_isolate);
+      Handle<Code> code =
+          Factory::CodeBuilder(i_isolate, desc, CodeKind::FOR_TESTING).Build();
+      if (i % 2 == 0) survivors->set(i / 2, *code);
+    }
+    CcTest::CollectAllGarbage(i_isolate);
+    Sweeper* sweeper = heap->mark_compact_collector()->sweeper();
+    CHECK(sweeper->sweeping_in_progress());
+    CHECK(sweeper->sweep_code_space_concurrently());
+
+    // Looking up code objects must be safe while code pages are swept by the
+    // sweeper tasks.
+    for (int i = 0; i < survivors->length(); i++) {
+      Code code = Code::cast(survivors->get(i));
+      CHECK_EQ(code, i_isolate->FindCodeObject(code.InstructionStart()));
+    }
+
+    // The main thread does not sweep here, so all code pages are swept by the
+    // sweeper tasks. Joining the sweeper job would make the main thread
+    // contribute, so poll for the tasks to finish instead.
+    const int kMaxWaitIterations = 10000;
+    for (int i = 0;
+         i < kMaxWaitIterations && sweeper->AreSweeperTasksRunning(); i++) {
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+    }
+    CHECK(!sweeper->AreSweeperTasksRunning());
+    CHECK(sweeper->IsSweepingListEmptySafe(CODE_SPACE));
+    for (Page* page : *heap->code_space()) {
+      CHECK(page->SweepingDone());
+    }
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+    for (int i = 0; i < survivors->length(); i++) {
+      Code code = Code::cast(survivors->get(i));
+      CHECK_EQ(code, i_isolate->FindCodeObject(code.InstructionStart()));
+    }
+  }
+  isolate->Dispose();
+}
+
+#ifdef ENABLE_MINOR_MC
+namespace {
+
+struct WeakLinkedList {
+  Handle<FixedArray> head;
+  int length;
+  bool finalized;
+};
+
+void CheckAndDestroyWeakLinkedList(const v8::WeakCallbackInfo<void>& data) {
+  WeakLinkedList* list = static_cast<WeakLinkedList*>(data.GetParameter());
+  FixedArray current = *list->head;
+  for (int i = 0; i < list->length; i++) {
+    CHECK_EQ(Smi::FromInt(i), current.get(0));
+    if (i + 1 < list->length) current = FixedArray::cast(current.get(1));
+  }
+  GlobalHandles::Destroy(list->head.location());
+  list->finalized = true;
+}
+
+}  // namespace
+
+TEST(MinorMCParallelMarkingKeepsLinkedListAlive) {
+  if (FLAG_single_generation) return;
+  ManualGCScope manual_gc_scope;
+  FLAG_minor_mc = true;
+  FLAG_minor_mc_parallel_marking = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  // The list is only reachable through a weak global handle with a finalizer,
+  // which is not part of the root set. Its head is pushed onto the marking
+  // worklist after root marking, so the rest of the list is marked by the
+  // job that drains the worklist.
+  WeakLinkedList list = {Handle<FixedArray>(), 5000, false};
+  {
+    HandleScope scope(isolate);
+    Handle<FixedArray> head = factory->NewFixedArray(2);
+    head->set(0, Smi::FromInt(0));
+    Handle<FixedArray> current = head;
+    for (int i = 1; i < list.length; i++) {
+      Handle<FixedArray> next = factory->NewFixedArray(2);
+      next->set(0, Smi::FromInt(i));
+      current->set(1, *next);
+      current = next;
+    }
+    CHECK(Heap::InYoungGeneration(*head));
+    list.head = isolate->global_handles()->Create(*head);
+  }
+  GlobalHandles::MakeWeak(list.head.location(), &list,
+                          &CheckAndDestroyWeakLinkedList,
+                          v8::WeakCallbackType::kFinalizer);
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(list.finalized);
+}
+#endif  // ENABLE_MINOR_MC
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -37,6 +37,7 @@
 #include "src/heap/large-spaces.h"
 #include "src/heap/memory-allocator.h"
 #include "src/heap/memory-chunk.h"
+#include "src/heap/page-pool.h"
 #include "src/heap/spaces-inl.h"
 #include "src/heap/spaces.h"
 #include "src/objects/free-space.h"
@@ -229,6 +230,116 @@ TEST(MemoryAllocator) {
   // OldSpace's destructor will tear down the space and free up all pages.
 }
 
+TEST(MemoryAllocatorHugePageRegion) {
+  FLAG_huge_pages = true;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  TestMemoryAllocatorScope test_allocator_scope(isolate, heap->MaxReserved());
+  MemoryAllocator* memory_allocator = test_allocator_scope.allocator();
+
+  const size_t huge_page_size = base::OS::HugePageSize();
+  const base::AddressRegion region = memory_allocator->huge_page_region();
+  if (huge_page_size == 0) {
+    // Huge pages are not supported on this platform.
+    CHECK(region.is_empty());
+    CHECK(!memory_allocator->huge_pages_advised());
+  } else {
+    CHECK(!region.is_empty());
+    CHECK(IsAligned(region.begin(), huge_page_size));
+    CHECK(IsAligned(region.size(), huge_page_size));
+    CHECK_LE(region.size(),
+             RoundUp(FLAG_huge_page_region_size * MB, huge_page_size));
+  }
+
+  OldSpace faked_space(heap);
+  for (int i = 0; i < 2; i++) {
+    Page* page = memory_allocator->AllocatePage(
+        faked_space.AreaSize(), static_cast<PagedSpace*>(&faked_space),
+        NOT_EXECUTABLE);
+    CHECK_NOT_NULL(page);
+    faked_space.memory_chunk_list().PushBack(page);
+    if (huge_page_size == 0) {
+      CHECK(!memory_allocator->IsInHugePageRegion(page->address()));
+      continue;
+    }
+    // Old space pages come from the region and never straddle a huge page
+    // boundary.
+    CHECK(memory_allocator->IsInHugePageRegion(page->address()));
+    CHECK_EQ(RoundDown(page->address(), huge_page_size),
+             RoundDown(page->address() + page->size() - 1, huge_page_size));
+    // The OS may reject the advice, e.g. on hosts without transparent huge
+    // pages.
+    if (memory_allocator->huge_pages_advised()) {
+      CHECK(memory_allocator->IsHugePageBacked(page->address()));
+    }
+  }
+
+  // OldSpace's destructor will tear down the space and free up all pages.
+}
+
+TEST(MemoryAllocatorPagePool) {
+  FLAG_page_pool_size = 64;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  PagePool* pool = PagePool::GetProcessWidePagePool();
+  // Pages cannot be shared with per-isolate pointer compression cages.
+  if (!pool->CanPool(isolate->page_allocator())) return;
+
+  TestMemoryAllocatorScope test_allocator_scope(isolate, heap->MaxReserved());
+  MemoryAllocator* memory_allocator = test_allocator_scope.allocator();
+
+  OldSpace faked_space(heap);
+  Page* page = memory_allocator->AllocatePage(
+      faked_space.AreaSize(), static_cast<PagedSpace*>(&faked_space),
+      NOT_EXECUTABLE);
+  const Address address = page->address();
+  const size_t pooled_pages = pool->NumberOfPages();
+  memory_allocator->Free<MemoryAllocator::kFull>(page);
+  CHECK_EQ(pooled_pages + 1, pool->NumberOfPages());
+
+  // The next page is drawn from the pool.
+  page = memory_allocator->AllocatePage(faked_space.AreaSize(),
+                                        static_cast<PagedSpace*>(&faked_space),
+                                        NOT_EXECUTABLE);
+  CHECK_EQ(address, page->address());
+  CHECK_EQ(pooled_pages, pool->NumberOfPages());
+  faked_space.memory_chunk_list().PushBack(page);
+
+  // OldSpace's destructor will tear down the space and free up all pages.
+}
+
+TEST(MemoryAllocatorLargePageCache) {
+  FLAG_large_page_cache_size = 8;
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  TestMemoryAllocatorScope test_allocator_scope(isolate, heap->MaxReserved());
+  MemoryAllocator* memory_allocator = test_allocator_scope.allocator();
+
+  OldLargeObjectSpace faked_space(heap);
+  const size_t object_size = 512 * KB;
+  LargePage* page = memory_allocator->AllocateLargePage(
+      object_size, &faked_space, NOT_EXECUTABLE);
+  const Address address = page->address();
+  const size_t chunk_size = page->size();
+  memory_allocator->Free<MemoryAllocator::kFull>(page);
+
+  // A smaller object of the same size class reuses the cached reservation.
+  page = memory_allocator->AllocateLargePage(object_size - 16 * KB,
+                                             &faked_space, NOT_EXECUTABLE);
+  CHECK_EQ(address, page->address());
+  CHECK_EQ(chunk_size, page->size());
+  CHECK_EQ(page->area_start() + object_size - 16 * KB, page->area_end());
+  memory_allocator->Free<MemoryAllocator::kFull>(page);
+
+  // Executable pages are never cached.
+  page = memory_allocator->AllocateLargePage(object_size, &faked_space,
+                                             EXECUTABLE);
+  CHECK_NE(address, page->address());
+  memory_allocator->Free<MemoryAllocator::kFull>(page);
+}
+
 TEST(ComputeDiscardMemoryAreas) {
   base::AddressRegion memory_area;
   size_t page_size = MemoryAllocator::GetCommitPageSize();
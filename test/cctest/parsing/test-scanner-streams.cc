@@ -410,6 +410,46 @@ TEST(Utf8SingleByteChunks) {
   }
 }
 
+TEST(Utf8TwoByteSequencesAndSeek) {
+  // Latin-1 and other two-byte sequences mixed with ascii, an overlong
+  // sequence (0xC0 0x80) and a lead byte without continuation (0xC3 'x').
+  const char two_byte_utf8[] =
+      "caf\xC3\xA9 na\xC3\xAFve \xC3\xA5\xC3\xA4\xC3\xB6\xDF\xBF"
+      "\xC0\x80\xC3x \xC2\x80";
+  const uint16_t two_byte_ucs2[] = {
+      'c', 'a', 'f',   0xE9,   ' ',    'n', 'a', 0xEF, 'v', 'e', ' ',
+      0xE5, 0xE4, 0xF6, 0x7FF, 0xFFFD, 0xFFFD, 0xFFFD, 'x', ' ', 0x80};
+  const size_t len = strlen(two_byte_utf8);
+  const size_t ucs2_len = arraysize(two_byte_ucs2);
+  char buffer[arraysize(two_byte_utf8) + 3];
+  for (size_t i = 1; i < len; i++) {
+    // Split the string at each byte, as in Utf8ChunkBoundaries.
+    memcpy(buffer, two_byte_utf8, i);
+    memcpy(buffer + i + 1, two_byte_utf8 + i, len - i);
+    buffer[i] = '\0';
+    buffer[len + 1] = '\0';
+    buffer[len + 2] = '\0';
+    const char* chunks[] = {buffer, buffer + i + 1, buffer + len + 2};
+
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+    for (size_t j = 0; j < ucs2_len; j++) {
+      CHECK_EQ(two_byte_ucs2[j], stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+
+    // Seeking backwards has to find the same characters again.
+    for (size_t j = ucs2_len; j-- > 0;) {
+      stream->Seek(j);
+      CHECK_EQ(two_byte_ucs2[j], stream->Advance());
+    }
+  }
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
@@ -29,16 +29,21 @@
 #include <wchar.h>
 
 #include <memory>
+#include <sstream>
+#include <string>
 
 #include "include/v8-function.h"
 #include "include/v8-local-handle.h"
 #include "include/v8-profiler.h"
 #include "include/v8-script.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/script-details.h"
 #include "src/diagnostics/disasm.h"
+#include "src/execution/optimization-profile.h"
+#include "src/execution/runtime-profiler.h"
 #include "src/heap/factory.h"
 #include "src/heap/spaces.h"
 #include "src/init/v8.h"
@@ -999,5 +1004,241 @@ TEST(ProfilerEnabledDuringBackgroundCompile) {
   cpu_profiler->StopProfiling(profile);
 }
 
+namespace {
+
+// Runs one runtime profiler tick for the closest JavaScript frame, i.e. the
+// interpreted function that called {tick}.
+void TickRuntimeProfiler(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  CcTest::i_isolate()
+      ->runtime_profiler()
+      ->MarkCandidatesForOptimizationFromBytecode();
+}
+
+Handle<JSFunction> GetJSFunction(v8::Local<v8::Context> context,
+                                 const char* name) {
+  return Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(
+          context->Global()->Get(context, v8_str(name)).ToLocalChecked())));
+}
+
+bool IsMarkedForOptimization(Handle<JSFunction> function) {
+  return function->IsMarkedForOptimization() ||
+         function->IsMarkedForConcurrentOptimization();
+}
+
+// Checks whether a single profiler tick marks a previously optimized and a
+// never optimized function for optimization.
+void TestEarlyReoptimization(bool early_reoptimization) {
+  if (i::FLAG_always_opt || !i::FLAG_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_early_reoptimization = early_reoptimization;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer()) return;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  CHECK(context->Global()
+            ->Set(context, v8_str("tick"),
+                  v8::FunctionTemplate::New(isolate, TickRuntimeProfiler)
+                      ->GetFunction(context)
+                      .ToLocalChecked())
+            .FromJust());
+
+  // The bodies are too large for the small function heuristic, and need
+  // several ticks to become hot.
+  const char* body =
+      "(x) {"
+      "  var a = x + 1; a = a * x + 2; a = a * x + 3; a = a * x + 4;"
+      "  a = a * x + 5; a = a * x + 6; a = a * x + 7; a = a * x + 8;"
+      "  a = a * x + 9; a = a * x + 10; a = a * x + 11; a = a * x + 12;"
+      "  if (x > 0) tick();"
+      "  return a;"
+      "}";
+  CompileRun((std::string("function hinted") + body +
+              "function unhinted" + body +
+              "%EnsureFeedbackVectorForFunction(hinted);"
+              "%EnsureFeedbackVectorForFunction(unhinted);")
+                 .c_str());
+  Handle<JSFunction> hinted = GetJSFunction(context, "hinted");
+  Handle<JSFunction> unhinted = GetJSFunction(context, "unhinted");
+  CHECK_GE(hinted->shared().GetBytecodeArray(CcTest::i_isolate()).length(),
+           81);
+
+  // Pretend {hinted} was deserialized from a code cache produced after it
+  // had been optimized.
+  hinted->shared().set_was_optimized(true);
+  CHECK(!unhinted->shared().was_optimized());
+
+  CompileRun("hinted(1); unhinted(1);");
+  CHECK_EQ(1, hinted->feedback_vector().profiler_ticks());
+  CHECK_EQ(1, unhinted->feedback_vector().profiler_ticks());
+  CHECK_EQ(early_reoptimization, IsMarkedForOptimization(hinted));
+  CHECK(!IsMarkedForOptimization(unhinted));
+}
+
+}  // namespace
+
+TEST(EarlyReoptimizationOfPreviouslyOptimizedFunction) {
+  TestEarlyReoptimization(true);
+}
+
+TEST(NoEarlyReoptimizationByDefault) {
+  CHECK(!i::FLAG_early_reoptimization);
+  TestEarlyReoptimization(false);
+}
+
+namespace {
+
+// Returns the number of profiler ticks after which a function that is too
+// large for the small function heuristic is marked for optimization.
+int TicksBeforeOptimization() {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  CHECK(context->Global()
+            ->Set(context, v8_str("tick"),
+                  v8::FunctionTemplate::New(isolate, TickRuntimeProfiler)
+                      ->GetFunction(context)
+                      .ToLocalChecked())
+            .FromJust());
+  CompileRun(
+      "function f(x) {"
+      "  var a = x + 1; a = a * x + 2; a = a * x + 3; a = a * x + 4;"
+      "  a = a * x + 5; a = a * x + 6; a = a * x + 7; a = a * x + 8;"
+      "  a = a * x + 9; a = a * x + 10; a = a * x + 11; a = a * x + 12;"
+      "  if (x > 0) tick();"
+      "  return a;"
+      "}"
+      "%EnsureFeedbackVectorForFunction(f);");
+  Handle<JSFunction> f = GetJSFunction(context, "f");
+  CHECK_GE(f->shared().GetBytecodeArray(CcTest::i_isolate()).length(), 81);
+
+  const int kMaxTicks = 10;
+  for (int ticks = 1; ticks <= kMaxTicks; ticks++) {
+    CompileRun("f(1);");
+    CHECK_EQ(ticks, f->feedback_vector().profiler_ticks());
+    if (IsMarkedForOptimization(f)) return ticks;
+  }
+  return kMaxTicks + 1;
+}
+
+}  // namespace
+
+TEST(MidTierTicksBeforeOptimization) {
+  if (i::FLAG_always_opt || !i::FLAG_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_turboprop = true;
+  i::FLAG_turboprop_as_toptier = false;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer()) return;
+  // Functions tier up to the Turboprop mid-tier after a single tick.
+  CHECK_EQ(1, TicksBeforeOptimization());
+}
+
+TEST(TopTierTicksBeforeOptimization) {
+  if (i::FLAG_always_opt || !i::FLAG_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_turboprop = false;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer()) return;
+  // Without a mid-tier, functions need several ticks to tier up to TurboFan.
+  CHECK_EQ(3, TicksBeforeOptimization());
+}
+
+namespace {
+
+// Returns a path in the temporary directory that is unique to this process.
+std::string TemporaryFilePath(const char* name) {
+#if V8_OS_WIN
+  const char* directory = getenv("TEMP");
+  if (directory == nullptr) directory = ".";
+#else
+  const char* directory = getenv("TMPDIR");
+  if (directory == nullptr) directory = "/tmp";
+#endif
+  std::ostringstream path;
+  path << directory << base::OS::DirectorySeparator()
+       << base::OS::GetCurrentProcessId() << "-" << name;
+  return path.str();
+}
+
+}  // namespace
+
+TEST(OptimizationProfileRoundTrip) {
+  if (i::FLAG_always_opt || !i::FLAG_opt || i::FLAG_turboprop) return;
+  i::FLAG_allow_natives_syntax = true;
+  CcTest::InitializeVM();
+  if (!CcTest::i_isolate()->use_optimizer()) return;
+  const std::string profile_path =
+      TemporaryFilePath("optimization-profile-round-trip.txt");
+  const char* kScriptName = "optimization-profile-test.js";
+  const char* source =
+      "function hot(x) { return x + 1; }"
+      "function cold(x) { return x - 1; }";
+  // Same script name and function positions, but a different source.
+  const char* edited_source =
+      "function hot(x) { return x + 2; }"
+      "function cold(x) { return x - 2; }";
+
+  // Optimize {hot} and write the profile.
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+    CompileRunWithOrigin(source, kScriptName);
+    CompileRun(
+        "%PrepareFunctionForOptimization(hot);"
+        "hot(1); hot(2);"
+        "%OptimizeFunctionOnNextCall(hot);"
+        "hot(3); cold(1);");
+    Handle<JSFunction> hot = GetJSFunction(context, "hot");
+    Handle<JSFunction> cold = GetJSFunction(context, "cold");
+    CHECK(hot->shared().was_optimized());
+    CHECK(!cold->shared().was_optimized());
+    OptimizationProfile::Write(CcTest::i_isolate(), profile_path.c_str());
+
+    std::unique_ptr<OptimizationProfile> profile =
+        OptimizationProfile::Read(profile_path.c_str());
+    CHECK_NOT_NULL(profile);
+    CHECK(profile->Contains(hot->shared()));
+    CHECK(!profile->Contains(cold->shared()));
+  }
+
+  // A new isolate that reads the profile marks {hot} as previously optimized
+  // once it allocates a feedback vector, but not {cold}. Functions of an
+  // edited script are not marked.
+  i::FLAG_optimization_profile_input = profile_path.c_str();
+  FlagList::EnforceFlagImplications();
+  CHECK(i::FLAG_early_reoptimization);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CHECK_NOT_NULL(
+        reinterpret_cast<Isolate*>(isolate)->optimization_profile());
+
+    CompileRunWithOrigin(edited_source, kScriptName);
+    Handle<JSFunction> edited_hot = GetJSFunction(context, "hot");
+    CompileRun("%EnsureFeedbackVectorForFunction(hot);");
+    CHECK(!edited_hot->shared().was_optimized());
+
+    CompileRunWithOrigin(source, kScriptName);
+    Handle<JSFunction> hot = GetJSFunction(context, "hot");
+    Handle<JSFunction> cold = GetJSFunction(context, "cold");
+    CHECK(!hot->shared().was_optimized());
+    CompileRun(
+        "%EnsureFeedbackVectorForFunction(hot);"
+        "%EnsureFeedbackVectorForFunction(cold);");
+    CHECK(hot->shared().was_optimized());
+    CHECK(!cold->shared().was_optimized());
+  }
+  isolate->Dispose();
+  i::FLAG_optimization_profile_input = nullptr;
+  CHECK(base::OS::Remove(profile_path.c_str()));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -2603,6 +2603,82 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+namespace {
+
+// Deserializes |cache| for |source| into a new isolate and returns whether
+// the function "f" is marked as having been optimized. Nothing is run in the
+// new isolate, so the bit can only come from the code cache.
+bool DeserializedFunctionWasOptimized(const char* source,
+                                      v8::ScriptCompiler::CachedData* cache) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  bool was_optimized = false;
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+    Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source script_source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &script_source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iterator(
+        i_isolate2, Script::cast(toplevel->script()));
+    bool found = false;
+    for (SharedFunctionInfo shared = iterator.Next(); !shared.is_null();
+         shared = iterator.Next()) {
+      if (!shared.Name().IsOneByteEqualTo(base::CStrVector("f"))) continue;
+      found = true;
+      was_optimized = shared.was_optimized();
+    }
+    CHECK(found);
+  }
+  isolate2->Dispose();
+  return was_optimized;
+}
+
+}  // namespace
+
+TEST(CodeSerializerKeepsOptimizationHint) {
+  if (!FLAG_opt || FLAG_turboprop || FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FlagList::EnforceFlagImplications();
+  const char* source =
+      "function f() { return 'abc'; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+  // The hint that {f} reached the top tier survives the round trip through
+  // the code cache.
+  CHECK(DeserializedFunctionWasOptimized(source, cache));
+}
+
+TEST(CodeSerializerOmitsOptimizationHintIfNotOptimized) {
+  if (!FLAG_opt || FLAG_turboprop || FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FlagList::EnforceFlagImplications();
+  const char* source =
+      "function f() { return 'abc'; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f();"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+  CHECK(!DeserializedFunctionWasOptimized(source, cache));
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -31,6 +31,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/mark-compact.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/js-collection-inl.h"
 #include "src/objects/objects-inl.h"
@@ -363,6 +364,54 @@ TEST(WeakMapsWithChainedEntries) {
   CHECK_EQ(1, i_isolate->heap()->gc_count() - initial_gc_count);
 }
 
+TEST(WeakMapChainIncrementalEphemeronMarking) {
+  if (!FLAG_incremental_marking) return;
+  FLAG_incremental_ephemeron_marking = true;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::i_isolate()->heap();
+  CompileRun(
+      "var map = new WeakMap();"
+      "var head = {};"
+      "(function() {"
+      "  var key = head;"
+      "  for (var i = 0; i < 1000; i++) {"
+      "    var value = {};"
+      "    map.set(key, value);"
+      "    key = value;"
+      "  }"
+      "  key.marker = 42;"
+      "})();");
+  Handle<JSWeakMap> weakmap = Handle<JSWeakMap>::cast(
+      v8::Utils::OpenHandle(*CompileRun("map").As<v8::Object>()));
+  heap::SimulateIncrementalMarking(heap, true);
+
+  // The whole chain is resolved by incremental marking. Without incremental
+  // ephemeron marking, values further down the chain are only marked by the
+  // fixpoint iteration in the atomic pause.
+  MarkCompactCollector::MarkingState* marking_state =
+      heap->mark_compact_collector()->marking_state();
+  EphemeronHashTable table = EphemeronHashTable::cast(weakmap->table());
+  ReadOnlyRoots roots(heap);
+  int marked_values = 0;
+  for (InternalIndex i : table.IterateEntries()) {
+    Object key;
+    if (!table.ToKey(roots, i, &key)) continue;
+    if (marking_state->IsBlackOrGrey(HeapObject::cast(table.ValueAt(i)))) {
+      marked_values++;
+    }
+  }
+  CHECK_EQ(1000, marked_values);
+
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(42, CompileRun("var key = head;"
+                          "for (var i = 0; i < 1000; i++) key = map.get(key);"
+                          "key.marker")
+                   ->Int32Value(CcTest::isolate()->GetCurrentContext())
+                   .FromJust());
+}
+
 }  // namespace test_weakmaps
 }  // namespace internal
 }  // namespace v8
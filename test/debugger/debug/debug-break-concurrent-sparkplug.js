@@ -0,0 +1,50 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --sparkplug-filter="test*"
+// Flags: --concurrent-sparkplug --no-always-opt
+// Flags: --baseline-batch-compilation --baseline-batch-compilation-threshold=0
+// Flags: --scale-factor-for-feedback-allocation=2 --lazy-feedback-allocation
+
+// Tests that baseline code compiled on a background thread is not installed
+// for a function that got a breakpoint before the install.
+
+var Debug = debug.Debug;
+var break_count = 0;
+var exception = null;
+
+function listener(event, exec_state, event_data, data) {
+  if (event != Debug.DebugEvent.Break) return;
+  try {
+    assertTrue(exec_state.frame().sourceLineText().includes('Break'));
+    break_count++;
+  } catch (e) {
+    exception = e;
+    print(e);
+  }
+}
+
+function test(a, b) {
+  return a + b;  // Break
+}
+
+%NeverOptimizeFunction(test);
+Debug.setListener(listener);
+
+// Send test to the background thread and set a breakpoint before the compiled
+// batch is installed.
+for (let i = 0; i < 5; ++i) {
+  test(i, 4711);
+}
+var bp = Debug.setBreakPoint(test, 1);
+%WaitForBaselineCompilation();
+
+assertEquals(3, test(1, 2));
+assertEquals(3, test(1, 2));
+assertFalse(isBaseline(test));
+assertEquals(2, break_count);
+
+Debug.clearBreakPoint(bp);
+Debug.setListener(null);
+assertNull(exception);
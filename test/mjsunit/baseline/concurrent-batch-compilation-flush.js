@@ -0,0 +1,67 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --sparkplug-filter="test*"
+// Flags: --concurrent-sparkplug --allow-natives-syntax --expose-gc
+// Flags: --baseline-batch-compilation --no-opt
+// Flags: --baseline-batch-compilation-threshold=200
+// Flags: --scale-factor-for-feedback-allocation=2
+// Flags: --flush-bytecode --stress-flush-code
+
+// Flags to drive Fuzzers into the right direction
+// TODO(v8:11853): Remove these flags once fuzzers handle flag implications
+// better.
+// Flags: --lazy-feedback-allocation --no-stress-concurrent-inlining
+
+function HasByteCode(f) {
+  let opt_status = %GetOptimizationStatus(f);
+  return (opt_status & V8OptimizationStatus.kInterpreted) !== 0;
+}
+
+// Bytecode length 24 -> estimated instruction size 120 - 168, so a batch is
+// compiled once it contains two of these functions.
+function test_flushed(a, b) {
+  return (a + b + 11) * 42 / a % b;
+}
+function test_pending(a, b) {
+  return (a + b + 11) * 42 / a % b;
+}
+function test_trigger(a, b) {
+  return (a + b + 11) * 42 / a % b;
+}
+
+// Flush the bytecode of an enqueued function before its batch is handed to
+// the background thread. The batch has to skip it.
+for (let i = 0; i < 5; ++i) {
+  test_flushed(i, 4711);
+}
+assertFalse(isBaseline(test_flushed));
+gc();
+assertFalse(HasByteCode(test_flushed));
+
+for (let i = 0; i < 5; ++i) {
+  test_pending(i, 4711);
+}
+%WaitForBaselineCompilation();
+test_pending(1, 2);
+test_pending(1, 2);
+assertTrue(isBaseline(test_pending));
+assertFalse(isBaseline(test_flushed));
+
+// A batch that was sent to the background thread keeps the bytecode of its
+// functions alive, so a GC before the install does not flush it.
+for (let i = 0; i < 5; ++i) {
+  test_flushed(i, 4711);
+}
+for (let i = 0; i < 5; ++i) {
+  test_trigger(i, 4711);
+}
+gc();
+%WaitForBaselineCompilation();
+test_flushed(1, 2);
+test_flushed(1, 2);
+test_trigger(1, 2);
+test_trigger(1, 2);
+assertTrue(isBaseline(test_flushed));
+assertTrue(isBaseline(test_trigger));
@@ -0,0 +1,81 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --sparkplug-filter="test*"
+// Flags: --concurrent-sparkplug --allow-natives-syntax --expose-gc
+// Flags: --baseline-batch-compilation --baseline-batch-compilation-threshold=0
+// Flags: --scale-factor-for-feedback-allocation=2 --no-always-opt
+// Flags: --stress-compaction
+
+// Flags to drive Fuzzers into the right direction
+// TODO(v8:11853): Remove these flags once fuzzers handle flag implications
+// better.
+// Flags: --lazy-feedback-allocation --no-stress-concurrent-inlining
+
+// Basic test
+(function() {
+  function test1(a, b) {
+    return (a + b + 11) * 42 / a % b;
+  }
+
+  %NeverOptimizeFunction(test1);
+  // Trigger bytecode budget interrupt for test1, which sends it to the
+  // background thread.
+  for (let i = 0; i < 5; ++i) {
+    test1(i, 4711);
+  }
+  %WaitForBaselineCompilation();
+  // The first call installs the baseline code, the second one attaches it to
+  // the function.
+  test1(1, 2);
+  test1(1, 2);
+  assertTrue(isBaseline(test1));
+})();
+
+// Test installing code after a compacting GC moved the objects the compiled
+// batch refers to.
+(function() {
+  function test_gc(a, b) {
+    return (a + b + 11) * 42 / a % b;
+  }
+
+  %NeverOptimizeFunction(test_gc);
+  for (let i = 0; i < 5; ++i) {
+    test_gc(i, 4711);
+  }
+  gc();
+  gc();
+  %WaitForBaselineCompilation();
+  test_gc(1, 2);
+  test_gc(1, 2);
+  assertTrue(isBaseline(test_gc));
+  assertEquals((1 + 2 + 11) * 42 / 1 % 2, test_gc(1, 2));
+})();
+
+// Test a batch where the only strong reference to the function is held by the
+// background compiler.
+(function() {
+  function test_weak(a, b) {
+    return (a + b + 11) * 42 / a % b;
+  }
+
+  %NeverOptimizeFunction(test_weak);
+  for (let i = 0; i < 5; ++i) {
+    test_weak(i, 4711);
+  }
+  test_weak = null;
+  gc();
+  %WaitForBaselineCompilation();
+  function test_other(a, b) {
+    return a + b;
+  }
+  %NeverOptimizeFunction(test_other);
+  for (let i = 0; i < 5; ++i) {
+    test_other(i, 4711);
+  }
+  %WaitForBaselineCompilation();
+  test_other(1, 2);
+  test_other(1, 2);
+  assertTrue(isBaseline(test_other));
+})();
@@ -0,0 +1,50 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Loops guarded by the length of the accessed array only drop their bounds
+// checks if the guard and the access agree.
+(function TestSumGuardedByLength() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  const a = new Float64Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(0, sum(new Float64Array(0)));
+})();
+
+(function TestCopyGuardedByOtherLength() {
+  function copy(dst, src) {
+    for (let i = 0; i < src.length; i++) dst[i] = src[i];
+    return dst;
+  }
+  %PrepareFunctionForOptimization(copy);
+  assertEquals([1, 2], Array.from(copy(new Int32Array(2), [1, 2])));
+  assertEquals([1, 2], Array.from(copy(new Int32Array(2), [1, 2])));
+  %OptimizeFunctionOnNextCall(copy);
+  assertEquals([1, 2], Array.from(copy(new Int32Array(2), [1, 2])));
+  // The store to {dst} is still checked against its own length.
+  assertEquals([1, 2], Array.from(copy(new Int32Array(2), [1, 2, 3])));
+})();
+
+(function TestCountingDown() {
+  function last(a) {
+    let s = 0;
+    for (let i = a.length - 1; i >= 0; i--) s = s * 10 + a[i];
+    return s;
+  }
+  const a = new Uint8Array([1, 2, 3]);
+  %PrepareFunctionForOptimization(last);
+  assertEquals(321, last(a));
+  assertEquals(321, last(a));
+  %OptimizeFunctionOnNextCall(last);
+  assertEquals(321, last(a));
+})();
@@ -0,0 +1,113 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-mid-tier-regalloc-threshold=0
+// Flags: --no-turboprop
+
+// With a threshold of 0, every TurboFan compilation uses the mid-tier
+// register allocator.
+
+(function TestIntegerAndCalls() {
+  function callee(a, b) { return a * b; }
+  function f(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+      sum = (sum + callee(i, i + 1)) | 0;
+    }
+    return sum;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(f(10), f(10));
+  const expected = f(100);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f(100));
+  assertOptimized(f);
+})();
+
+(function TestManyLiveDoubles() {
+  function f(x) {
+    const a = x + 0.5, b = x * 1.5, c = x - 2.5, d = x / 3.5;
+    const e = a * b, g = c * d, h = a + d, i = b - c;
+    return Math.sqrt(Math.abs(e + g + h + i + a + b + c + d));
+  }
+  %PrepareFunctionForOptimization(f);
+  const expected = f(1.25);
+  f(2.5);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f(1.25));
+  assertOptimized(f);
+})();
+
+(function TestTryCatch() {
+  function thrower(x) {
+    if (x > 5) throw x;
+    return x;
+  }
+  function f(n) {
+    let caught = 0;
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+      try {
+        sum += thrower(i);
+      } catch (e) {
+        caught += e;
+      } finally {
+        sum++;
+      }
+    }
+    return [sum, caught];
+  }
+  %PrepareFunctionForOptimization(f);
+  const expected = f(10);
+  f(10);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f(10));
+  assertOptimized(f);
+})();
+
+(function TestOsr() {
+  function f(n) {
+    let sum = 0.5;
+    for (let i = 0; i < n; i++) {
+      sum += i * 0.25;
+      if (i == 5) %OptimizeOsr();
+    }
+    return sum;
+  }
+  %PrepareFunctionForOptimization(f);
+  let expected = 0.5;
+  for (let i = 0; i < 100; i++) expected += i * 0.25;
+  assertEquals(expected, f(100));
+})();
+
+(function TestOsrInTryCatch() {
+  function f(n) {
+    let sum = 0;
+    try {
+      for (let i = 0; i < n; i++) {
+        sum += i;
+        if (i == 5) %OptimizeOsr();
+        if (i == n - 1) throw sum;
+      }
+    } catch (e) {
+      return e + 1;
+    }
+    return -1;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(4951, f(100));
+})();
+
+(function TestDeoptimization() {
+  function f(x, y) { return x + y; }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(3, f(1, 2));
+  assertEquals(5, f(2, 3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(7, f(3, 4));
+  assertOptimized(f);
+  // Passing strings deoptimizes, the frame state has to be intact.
+  assertEquals("ab", f("a", "b"));
+  assertUnoptimized(f);
+})();
@@ -0,0 +1,23 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-max-zone-memory=1
+
+// A function whose graph needs well over 1 MB of zone memory, while its
+// bytecode stays below --max-optimized-bytecode-size. TurboFan has to give up
+// on it instead of finishing the compilation.
+let body = "let x = a;\n";
+for (let i = 0; i < 2000; i++) {
+  body += `x = (x * ${i + 2} + b[${i % 16}]) | 0;\n`;
+}
+body += "return x;\n";
+const f = new Function("a", "b", body);
+
+const b = new Array(16).fill(1);
+%PrepareFunctionForOptimization(f);
+const expected = f(1, b);
+assertEquals(expected, f(1, b));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(expected, f(1, b));
+assertUnoptimized(f);
@@ -0,0 +1,42 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-lazy --use-external-strings
+
+var outer_var = 42;
+
+function lazy_outer() {
+  return outer_var;
+}
+
+function lazy_with_inner(a) {
+  function inner(b) { return a + b; }
+  return inner(1);
+}
+
+function* lazy_gen() {
+  yield 1;
+  yield 2;
+}
+
+async function lazy_async() {
+  return 42;
+}
+
+class LazyClass {
+  method() { return 42; }
+}
+
+function never_called() {
+  return undefined_variable;
+}
+
+assertEquals(42, lazy_outer());
+assertEquals(43, lazy_with_inner(42));
+var gen = lazy_gen();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+assertPromiseResult(lazy_async(), v => assertEquals(42, v));
+assertEquals(42, new LazyClass().method());
+assertThrows(never_called, ReferenceError);
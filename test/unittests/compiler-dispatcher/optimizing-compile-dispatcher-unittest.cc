@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <deque>
+
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/platform/semaphore.h"
@@ -13,6 +15,7 @@
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles.h"
 #include "src/heap/local-heap.h"
+#include "src/init/v8.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
 #include "test/unittests/test-helpers.h"
@@ -64,6 +67,94 @@ class BlockingCompilationJob : public OptimizedCompilationJob {
   base::Semaphore semaphore_;
 };
 
+// Holds back worker tasks until they are released, so that tests control
+// when background tasks pick up queued jobs. All other calls are forwarded to
+// the platform that was current at construction.
+class HoldingPlatform : public v8::Platform {
+ public:
+  HoldingPlatform() : old_platform_(V8::GetCurrentPlatform()) {
+    V8::SetPlatformForTesting(this);
+  }
+  ~HoldingPlatform() override {
+    ReleaseWorkerTasks();
+    V8::SetPlatformForTesting(old_platform_);
+  }
+  HoldingPlatform(const HoldingPlatform&) = delete;
+  HoldingPlatform& operator=(const HoldingPlatform&) = delete;
+
+  size_t HeldWorkerTasks() {
+    base::MutexGuard lock(&mutex_);
+    return worker_tasks_.size();
+  }
+
+  // Posts the oldest held worker task to the old platform.
+  void ReleaseWorkerTask() {
+    std::unique_ptr<v8::Task> task;
+    {
+      base::MutexGuard lock(&mutex_);
+      ASSERT_FALSE(worker_tasks_.empty());
+      task = std::move(worker_tasks_.front());
+      worker_tasks_.pop_front();
+    }
+    old_platform_->CallOnWorkerThread(std::move(task));
+  }
+
+  void ReleaseWorkerTasks() {
+    while (HeldWorkerTasks() > 0) ReleaseWorkerTask();
+  }
+
+  // v8::Platform implementation.
+  v8::PageAllocator* GetPageAllocator() override {
+    return old_platform_->GetPageAllocator();
+  }
+
+  int NumberOfWorkerThreads() override {
+    return old_platform_->NumberOfWorkerThreads();
+  }
+
+  std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(
+      v8::Isolate* isolate) override {
+    return old_platform_->GetForegroundTaskRunner(isolate);
+  }
+
+  void CallOnWorkerThread(std::unique_ptr<v8::Task> task) override {
+    base::MutexGuard lock(&mutex_);
+    worker_tasks_.push_back(std::move(task));
+  }
+
+  void CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> task,
+                                 double delay_in_seconds) override {
+    old_platform_->CallDelayedOnWorkerThread(std::move(task), delay_in_seconds);
+  }
+
+  std::unique_ptr<v8::JobHandle> PostJob(
+      v8::TaskPriority priority,
+      std::unique_ptr<v8::JobTask> job_task) override {
+    return old_platform_->PostJob(priority, std::move(job_task));
+  }
+
+  bool IdleTasksEnabled(v8::Isolate* isolate) override {
+    return old_platform_->IdleTasksEnabled(isolate);
+  }
+
+  double MonotonicallyIncreasingTime() override {
+    return old_platform_->MonotonicallyIncreasingTime();
+  }
+
+  double CurrentClockTimeMillis() override {
+    return old_platform_->CurrentClockTimeMillis();
+  }
+
+  v8::TracingController* GetTracingController() override {
+    return old_platform_->GetTracingController();
+  }
+
+ private:
+  v8::Platform* const old_platform_;
+  base::Mutex mutex_;
+  std::deque<std::unique_ptr<v8::Task>> worker_tasks_;
+};
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -97,5 +188,74 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, HotFunctionDisplacesColdJob) {
+  int old_queue_length = FLAG_concurrent_recompilation_queue_length;
+  FLAG_concurrent_recompilation_queue_length = 1;
+
+  Handle<JSFunction> cold =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  Handle<JSFunction> hot = RunJS<JSFunction>("(function h() {})");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), cold, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), hot, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(hot, &is_compiled_scope);
+  hot->feedback_vector().set_invocation_count(10, kRelaxedStore);
+
+  HoldingPlatform platform;
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  // The background task is held back, so the job stays in the queue.
+  dispatcher.QueueForOptimization(
+      new BlockingCompilationJob(i_isolate(), cold));
+  ASSERT_EQ(1u, platform.HeldWorkerTasks());
+  ASSERT_FALSE(dispatcher.IsQueueAvailable());
+
+  // A function that is not hotter than the queued one does not get a slot.
+  ASSERT_FALSE(dispatcher.TryMakeRoomFor(*cold));
+  ASSERT_TRUE(dispatcher.TryMakeRoomFor(*hot));
+  ASSERT_TRUE(dispatcher.IsQueueAvailable());
+
+  // The released task finds the queue empty.
+  platform.ReleaseWorkerTasks();
+  dispatcher.Stop();
+  FLAG_concurrent_recompilation_queue_length = old_queue_length;
+}
+
+TEST_F(OptimizingCompileDispatcherTest, HotFunctionIsCompiledFirst) {
+  Handle<JSFunction> cold =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  Handle<JSFunction> hot = RunJS<JSFunction>("(function h() {})");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), cold, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), hot, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(hot, &is_compiled_scope);
+  hot->feedback_vector().set_invocation_count(10, kRelaxedStore);
+
+  HoldingPlatform platform;
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+  dispatcher.QueueForOptimization(cold_job);
+  dispatcher.QueueForOptimization(hot_job);
+  ASSERT_EQ(2u, platform.HeldWorkerTasks());
+
+  // The first task picks the hot job although it was queued last.
+  platform.ReleaseWorkerTask();
+  while (!hot_job->IsBlocking()) {
+  }
+  ASSERT_FALSE(cold_job->IsBlocking());
+
+  // Unblock both jobs & finish.
+  cold_job->Signal();
+  hot_job->Signal();
+  platform.ReleaseWorkerTasks();
+  dispatcher.Stop();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,112 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-variable-optimizer.h"
+
+#include "src/compiler/feedback-source.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopVariableOptimizerTest : public GraphTest {
+ public:
+  LoopVariableOptimizerTest() : GraphTest(2), simplified_(zone()) {}
+  ~LoopVariableOptimizerTest() override = default;
+
+ protected:
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  Node* Length(int32_t index) {
+    return Parameter(Type::Range(0.0, kMaxSafeInteger, zone()), index);
+  }
+
+  // Builds the loop
+  //
+  //   for (i = initial; cmp(i, limit); i++) CheckBounds(i, length);
+  //
+  // and returns the CheckBounds node.
+  Node* BuildLoopWithBoundsCheck(double initial, const Operator* cmp,
+                                 Node* limit, Node* length) {
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* init = NumberConstant(initial);
+    Node* phi = graph()->NewNode(
+        common()->Phi(MachineRepresentation::kTagged, 2), init, init, loop);
+    NodeProperties::SetType(phi,
+                            Type::Range(initial, kMaxSafeInteger, zone()));
+
+    Node* cond = graph()->NewNode(cmp, phi, limit);
+    Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* check =
+        graph()->NewNode(simplified()->CheckBounds(FeedbackSource()), phi,
+                         length, effect_phi, if_true);
+    Node* add = graph()->NewNode(simplified()->NumberAdd(), phi,
+                                 NumberConstant(1));
+    phi->ReplaceInput(1, add);
+    effect_phi->ReplaceInput(1, check);
+    loop->ReplaceInput(1, if_true);
+
+    Node* exit = graph()->NewNode(common()->LoopExit(), if_false, loop);
+    Node* ret = graph()->NewNode(common()->Return(), Int32Constant(0), phi,
+                                 effect_phi, exit);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    return check;
+  }
+
+  void MarkRedundantBoundsChecks() {
+    LoopVariableOptimizer optimizer(graph(), common(), zone());
+    optimizer.Run();
+    optimizer.MarkRedundantBoundsChecks(simplified());
+  }
+
+  static bool AbortsOnOutOfBounds(Node* check) {
+    return CheckBoundsParametersOf(check->op()).flags() &
+           CheckBoundsFlag::kAbortOnOutOfBounds;
+  }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(LoopVariableOptimizerTest, BoundsCheckGuardedByLoopCondition) {
+  Node* length = Length(0);
+  Node* check = BuildLoopWithBoundsCheck(
+      0, simplified()->NumberLessThan(), length, length);
+  MarkRedundantBoundsChecks();
+  EXPECT_TRUE(AbortsOnOutOfBounds(check));
+}
+
+TEST_F(LoopVariableOptimizerTest, BoundsCheckWithNegativeInductionVariable) {
+  Node* length = Length(0);
+  Node* check = BuildLoopWithBoundsCheck(
+      -1, simplified()->NumberLessThan(), length, length);
+  MarkRedundantBoundsChecks();
+  EXPECT_FALSE(AbortsOnOutOfBounds(check));
+}
+
+TEST_F(LoopVariableOptimizerTest, BoundsCheckGuardedByNonStrictCondition) {
+  Node* length = Length(0);
+  Node* check = BuildLoopWithBoundsCheck(
+      0, simplified()->NumberLessThanOrEqual(), length, length);
+  MarkRedundantBoundsChecks();
+  EXPECT_FALSE(AbortsOnOutOfBounds(check));
+}
+
+TEST_F(LoopVariableOptimizerTest, BoundsCheckAgainstOtherLength) {
+  Node* check = BuildLoopWithBoundsCheck(0, simplified()->NumberLessThan(),
+                                         Length(0), Length(1));
+  MarkRedundantBoundsChecks();
+  EXPECT_FALSE(AbortsOnOutOfBounds(check));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -63,6 +63,12 @@ class MockPlatform : public cppgc::Platform {
   std::unique_ptr<TracingController> tracing_controller_;
 };
 
+constexpr GarbageCollector::Config kMinorConservativeAtomicConfig = {
+    GarbageCollector::Config::CollectionType::kMinor,
+    GarbageCollector::Config::StackState::kMayContainHeapPointers,
+    GarbageCollector::Config::MarkingType::kAtomic,
+    GarbageCollector::Config::SweepingType::kAtomic};
+
 }  // namespace
 
 TEST(GCInvokerTest, PrecideGCIsInvokedSynchronously) {
@@ -112,6 +118,45 @@ TEST(GCInvokerTest, ConservativeGCIsInvokedAsPreciseGCViaPlatform) {
   platform.RunAllForegroundTasks();
 }
 
+TEST(GCInvokerTest, MinorGCIsScheduledViaPlatform) {
+  testing::TestPlatform platform;
+  MockGarbageCollector gc;
+  GCInvoker invoker(&gc, &platform,
+                    cppgc::Heap::StackSupport::kSupportsConservativeStackScan);
+  EXPECT_CALL(gc, epoch).WillRepeatedly(::testing::Return(0));
+  EXPECT_CALL(gc, CollectGarbage).Times(0);
+  invoker.CollectGarbage(kMinorConservativeAtomicConfig);
+  ::testing::Mock::VerifyAndClearExpectations(&gc);
+  EXPECT_CALL(gc, epoch).WillRepeatedly(::testing::Return(0));
+  // The minor GC runs precisely in a non-nestable task.
+  EXPECT_CALL(gc, CollectGarbage(::testing::AllOf(
+                      ::testing::Field(
+                          &GarbageCollector::Config::collection_type,
+                          GarbageCollector::Config::CollectionType::kMinor),
+                      ::testing::Field(
+                          &GarbageCollector::Config::stack_state,
+                          GarbageCollector::Config::StackState::
+                              kNoHeapPointers))));
+  platform.RunAllForegroundTasks();
+}
+
+TEST(GCInvokerTest, PendingMinorGCIsUpgradedToMajorGC) {
+  testing::TestPlatform platform;
+  MockGarbageCollector gc;
+  GCInvoker invoker(&gc, &platform,
+                    cppgc::Heap::StackSupport::kNoConservativeStackScan);
+  EXPECT_CALL(gc, epoch).WillRepeatedly(::testing::Return(0));
+  // Only the major GC runs. The canceled minor GC task is skipped.
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(
+                      &GarbageCollector::Config::collection_type,
+                      GarbageCollector::Config::CollectionType::kMajor)));
+  invoker.CollectGarbage(kMinorConservativeAtomicConfig);
+  invoker.CollectGarbage(GarbageCollector::Config::ConservativeAtomicConfig());
+  // A later minor GC request does not downgrade the pending major GC.
+  invoker.CollectGarbage(kMinorConservativeAtomicConfig);
+  platform.RunAllForegroundTasks();
+}
+
 TEST(GCInvokerTest, IncrementalGCIsStarted) {
   // Since StartIncrementalGarbageCollection doesn't scan the stack, support for
   // conservative stack scanning should not matter.
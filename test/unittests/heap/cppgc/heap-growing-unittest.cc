@@ -174,5 +174,26 @@ TEST(HeapGrowingTest, IncrementalGCFinalized) {
   FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
 }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+TEST(HeapGrowingTest, MinorGCTriggered) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  // Use larger size to avoid running into small heap optimizations.
+  constexpr size_t kInitialHeapSize = 10 * HeapGrowing::kMinLimitIncrease;
+  constraints.initial_heap_size_bytes = kInitialHeapSize;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  ASSERT_LT(kInitialHeapSize + 1, growing.limit_for_incremental_gc());
+  ASSERT_LT(growing.young_generation_size(), kInitialHeapSize + 1);
+  EXPECT_CALL(gc, StartIncrementalGarbageCollection(::testing::_)).Times(0);
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(
+                      &GarbageCollector::Config::collection_type,
+                      GarbageCollector::Config::CollectionType::kMinor)));
+  FakeAllocate(&stats_collector, kInitialHeapSize + 1);
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
 }  // namespace internal
 }  // namespace cppgc
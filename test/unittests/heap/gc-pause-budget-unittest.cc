@@ -0,0 +1,96 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <limits>
+
+#include "src/heap/gc-pause-budget.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(GCPauseBudget, IncrementalMarkingStepSizeWithoutBudget) {
+  EXPECT_EQ(5, GCPauseBudget::EstimateIncrementalMarkingStepSizeInMs(0, 5));
+}
+
+TEST(GCPauseBudget, IncrementalMarkingStepSizeWithLargeBudget) {
+  EXPECT_EQ(5, GCPauseBudget::EstimateIncrementalMarkingStepSizeInMs(100, 5));
+}
+
+TEST(GCPauseBudget, IncrementalMarkingStepSizeWithSmallBudget) {
+  EXPECT_EQ(2 * GCPauseBudget::kConservativeTimeRatio,
+            GCPauseBudget::EstimateIncrementalMarkingStepSizeInMs(2, 5));
+}
+
+TEST(GCPauseBudget, MaxYoungGenerationCapacityWithoutBudget) {
+  EXPECT_EQ(std::numeric_limits<size_t>::max(),
+            GCPauseBudget::EstimateMaxYoungGenerationCapacity(0, 1 * MB));
+}
+
+TEST(GCPauseBudget, MaxYoungGenerationCapacityInitial) {
+  EXPECT_EQ(
+      static_cast<size_t>(GCPauseBudget::kInitialConservativeScavengeSpeed *
+                          GCPauseBudget::kConservativeTimeRatio),
+      GCPauseBudget::EstimateMaxYoungGenerationCapacity(1, 0));
+}
+
+TEST(GCPauseBudget, MaxYoungGenerationCapacityNonZero) {
+  const double scavenge_speed_in_bytes_per_ms = 2 * MB;
+  EXPECT_EQ(static_cast<size_t>(10 * scavenge_speed_in_bytes_per_ms *
+                                GCPauseBudget::kConservativeTimeRatio),
+            GCPauseBudget::EstimateMaxYoungGenerationCapacity(
+                10, scavenge_speed_in_bytes_per_ms));
+}
+
+TEST(GCPauseBudget, MaxYoungGenerationCapacityOverflow) {
+  EXPECT_EQ(std::numeric_limits<size_t>::max(),
+            GCPauseBudget::EstimateMaxYoungGenerationCapacity(
+                10, static_cast<double>(std::numeric_limits<size_t>::max())));
+}
+
+TEST(GCPauseBudget, MaxEvacuatedBytesWithoutBudget) {
+  EXPECT_EQ(std::numeric_limits<size_t>::max(),
+            GCPauseBudget::EstimateMaxEvacuatedBytes(0, 1 * MB));
+}
+
+TEST(GCPauseBudget, MaxEvacuatedBytesInitial) {
+  EXPECT_EQ(
+      static_cast<size_t>(GCPauseBudget::kInitialConservativeCompactionSpeed *
+                          GCPauseBudget::kConservativeTimeRatio),
+      GCPauseBudget::EstimateMaxEvacuatedBytes(1, 0));
+}
+
+TEST(GCPauseBudget, MaxEvacuatedBytesNonZero) {
+  const double compaction_speed_in_bytes_per_ms = 512 * KB;
+  EXPECT_EQ(static_cast<size_t>(4 * compaction_speed_in_bytes_per_ms *
+                                GCPauseBudget::kConservativeTimeRatio),
+            GCPauseBudget::EstimateMaxEvacuatedBytes(
+                4, compaction_speed_in_bytes_per_ms));
+}
+
+TEST(GCPauseBudget, MaxEvacuatedBytesDisabled) {
+  GCPauseBudget budget(nullptr, 0);
+  EXPECT_EQ(4 * MB, budget.MaxEvacuatedBytes(4 * MB, 256 * KB));
+}
+
+TEST(GCPauseBudget, NotifyGCPauseDisabled) {
+  GCPauseBudget budget(nullptr, 0);
+  EXPECT_FALSE(budget.IsEnabled());
+  EXPECT_FALSE(budget.NotifyGCPause(100));
+  EXPECT_EQ(0u, budget.pauses());
+  EXPECT_EQ(0u, budget.budget_misses());
+}
+
+TEST(GCPauseBudget, NotifyGCPauseCountsMisses) {
+  GCPauseBudget budget(nullptr, 10);
+  EXPECT_TRUE(budget.IsEnabled());
+  EXPECT_FALSE(budget.NotifyGCPause(5));
+  EXPECT_FALSE(budget.NotifyGCPause(10));
+  EXPECT_TRUE(budget.NotifyGCPause(15));
+  EXPECT_EQ(3u, budget.pauses());
+  EXPECT_EQ(1u, budget.budget_misses());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,92 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/scanner-search.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace scanner_search {
+
+namespace {
+
+// Characters around the boundaries of every predicate, including code units
+// that are negative as signed 16-bit values.
+const uint16_t kInterestingChars[] = {
+    'a',  'z',    'A',    'Z',    '0',    '9',    '_',    '$',
+    ' ',  '\t',   '\n',   '\r',   '\'',   '"',    '\\',   '*',
+    '/',  '`',    '@',    '[',    '{',    0x7F,   0x80,   0xE0,
+    0xFF, 0x2027, 0x2028, 0x2029, 0x202A, 0x8020, 0xFFFE, 0xFFFF};
+
+template <typename Predicate>
+const uint16_t* ScalarFind(const uint16_t* start, const uint16_t* end,
+                           Predicate matches) {
+  while (start < end && !matches(*start)) ++start;
+  return start;
+}
+
+// Runs |search| on every suffix of strings made of one repeated filler
+// character with a single other character at each position, and checks it
+// against the scalar predicate. This covers matches in the first and later
+// vector chunks as well as in the scalar tail.
+template <typename Search, typename Predicate>
+void CheckSearch(Search search, Predicate matches) {
+  constexpr int kMaxLength = 40;
+  for (uint16_t filler : kInterestingChars) {
+    for (uint16_t other : kInterestingChars) {
+      for (int at = 0; at < kMaxLength; at++) {
+        std::vector<uint16_t> chars(kMaxLength, filler);
+        chars[at] = other;
+        const uint16_t* end = chars.data() + chars.size();
+        for (const uint16_t* start = chars.data(); start <= end; start++) {
+          EXPECT_EQ(ScalarFind(start, end, matches), search(start, end));
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ScannerSearchTest, FindLineTerminator) {
+  CheckSearch(FindLineTerminator, IsLineTerminator);
+}
+
+TEST(ScannerSearchTest, FindChar) {
+  CheckSearch(
+      [](const uint16_t* start, const uint16_t* end) {
+        return FindChar(start, end, '*');
+      },
+      [](uint16_t c) { return c == '*'; });
+}
+
+TEST(ScannerSearchTest, FindNonBlank) {
+  CheckSearch(FindNonBlank, IsNotBlank);
+}
+
+TEST(ScannerSearchTest, FindNonAsciiIdentifierPart) {
+  CheckSearch(FindNonAsciiIdentifierPart, IsNotAsciiIdentifierPart);
+}
+
+TEST(ScannerSearchTest, FindPlainStringRunEnd) {
+  CheckSearch(FindPlainStringRunEnd, MayEndPlainStringRun);
+}
+
+TEST(ScannerSearchTest, ScalarPredicates) {
+  for (uint32_t c = 0; c <= 0xFFFF; c++) {
+    bool is_identifier_part = (c >= 'a' && c <= 'z') ||
+                              (c >= 'A' && c <= 'Z') ||
+                              (c >= '0' && c <= '9') || c == '_' || c == '$';
+    EXPECT_EQ(!is_identifier_part, IsNotAsciiIdentifierPart(c));
+    EXPECT_EQ(c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029,
+              IsLineTerminator(c));
+  }
+}
+
+}  // namespace scanner_search
+}  // namespace internal
+}  // namespace v8